@@ -0,0 +1,155 @@
+#include "Board.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include "Perft.hpp"
+#include <string>
+#include <string_view>
+
+using Chess::Board;
+using Chess::Move;
+using Chess::ParallelPerftOptions;
+using Chess::PerftPosition;
+using Chess::PromotionOption;
+
+/// Prints how to invoke the program to the output stream.
+void printUsage();
+
+/// Returns the move in a compact format (e.g. "E2E4" or "B7A8Q").
+std::string moveToString(Move const& move);
+
+/**
+ Runs perft on the position to the given depth and prints the leaves counted,
+ the time taken and the nodes per second. Threads are used only if options
+ are given, whereas moves are applied to copies of a Position if copyMake is
+ set. Returns false if the count does not match the known one.
+*/
+bool run(PerftPosition const& position, int depth, bool divide,
+         std::optional<ParallelPerftOptions> const& parallel, bool copyMake);
+
+int main(int argc, char* argv[]) {
+  int depth = 0;
+  std::string_view positionName = "startpos";
+  bool divide = false;
+  bool copyMake = false;
+  std::optional<ParallelPerftOptions> parallel;
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg = argv[i];
+    if (arg == "--divide") {
+      divide = true;
+    } else if (arg == "--copy-make") {
+      copyMake = true;
+    } else if ((arg == "--threads" || arg == "--hash") && i + 1 < argc) {
+      if (!parallel) {
+        parallel.emplace();
+      }
+      auto value = std::strtoull(argv[++i], nullptr, 10);
+      if (arg == "--threads") {
+        parallel->threads = static_cast<unsigned>(value);
+      } else {
+        // each entry of the table takes 16 bytes
+        parallel->tableEntries = value * 1024 * 1024 / 16;
+      }
+    } else if (depth == 0 && std::atoi(argv[i]) > 0) {
+      depth = std::atoi(argv[i]);
+    } else {
+      positionName = arg;
+    }
+  }
+
+  if (depth == 0) {
+    printUsage();
+    return EXIT_FAILURE;
+  }
+  // copies of a Position are only counted on one thread and without divisions
+  if (copyMake && (parallel || divide)) {
+    std::cout << "--copy-make cannot be combined with --divide, --threads or "
+                 "--hash\n";
+    printUsage();
+    return EXIT_FAILURE;
+  }
+
+  bool found = false;
+  bool allMatch = true;
+  for (auto const& position : Chess::standardPerftPositions()) {
+    if (positionName == "all" || positionName == position.name) {
+      found = true;
+      allMatch = run(position, depth, divide, parallel, copyMake) && allMatch;
+    }
+  }
+
+  if (!found) {
+    std::cout << "Unknown position " << positionName << "\n";
+    printUsage();
+    return EXIT_FAILURE;
+  }
+  return allMatch ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+void printUsage() {
+  std::cout << "Usage: perft <depth> [position|all] [--divide] "
+               "[--threads <count, 0 for all cores>] [--hash <MB, 0 for none>]\n"
+               "       perft <depth> [position|all] --copy-make\n";
+  std::cout << "Only the built-in positions are accepted, by name or all of "
+               "them at once; custom setups cannot be given.\n";
+  std::cout << "Available positions:";
+  for (auto const& position : Chess::standardPerftPositions()) {
+    std::cout << " " << position.name;
+  }
+  std::cout << "\n";
+}
+
+std::string moveToString(Move const& move) {
+  auto result = Board::coordinatesToString(move.source()) +
+                Board::coordinatesToString(move.destination());
+  if (auto promotion = move.promotion()) {
+    switch (*promotion) {
+    case PromotionOption::Queen: result += 'Q'; break;
+    case PromotionOption::Rook: result += 'R'; break;
+    case PromotionOption::Bishop: result += 'B'; break;
+    case PromotionOption::Knight: result += 'N'; break;
+    }
+  }
+  return result;
+}
+
+bool run(PerftPosition const& position, int depth, bool divide,
+         std::optional<ParallelPerftOptions> const& parallel, bool copyMake) {
+  auto board = position.build();
+  auto start = std::chrono::steady_clock::now();
+  std::uint64_t nodes = 0;
+  if (divide) {
+    auto divisions = parallel ?
+      Chess::perftDivideParallel(position.build, depth, *parallel) :
+      Chess::perftDivide(board, depth);
+    for (auto const& division : divisions) {
+      std::cout << moveToString(division.move) << ": " << division.nodes << "\n";
+      nodes += division.nodes;
+    }
+  } else if (parallel) {
+    nodes = Chess::perftParallel(position.build, depth, *parallel);
+  } else if (copyMake) {
+    nodes = Chess::perft(board.position(), depth);
+  } else {
+    nodes = Chess::perft(board, depth);
+  }
+  std::chrono::duration<double> elapsed =
+                                     std::chrono::steady_clock::now() - start;
+
+  std::cout << position.name << " depth " << depth << ": " << nodes
+            << " nodes in " << elapsed.count() << " s";
+  if (elapsed.count() > 0) {
+    std::cout << " (" << static_cast<std::uint64_t>(nodes / elapsed.count())
+              << " nodes/s)";
+  }
+  std::cout << "\n";
+
+  auto const& expected = position.expectedNodes;
+  if (static_cast<size_t>(depth) <= expected.size() &&
+      expected[depth - 1] != nodes) {
+    std::cout << "Mismatch: expected " << expected[depth - 1] << " nodes\n";
+    return false;
+  }
+  return true;
+}
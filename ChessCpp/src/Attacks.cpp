@@ -0,0 +1,295 @@
+#include "Attacks.hpp"
+#include <array>
+#include <stdexcept>
+#include <vector>
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#define CHESS_PEXT_AVAILABLE
+#endif
+
+// compilers other than MSVC only emit PEXT in functions targeting BMI2
+#if defined(__GNUC__)
+#define CHESS_TARGET_BMI2 __attribute__((target("bmi2")))
+#else
+#define CHESS_TARGET_BMI2
+#endif
+
+namespace Chess {
+
+/// Defines the number of squares on the board.
+int constexpr SQUARES = AbstractBoard::AREA;
+
+/**
+  Represents the magic multiplication used to map each relevant occupancy of
+  a slider's rays to its own entry of the attacks table.
+*/
+struct Magic {
+  Bitboard mask = 0;
+  Bitboard magic = 0;
+  unsigned shift = 0;
+  size_t offset = 0;
+
+  size_t index(Bitboard occupied) const {
+    return offset + static_cast<size_t>(((occupied & mask) * magic) >> shift);
+  }
+};
+
+/**
+  Contains the magics and the attacks of one type of slider. Tables indexed
+  with PEXT store no magics.
+*/
+struct SliderTable {
+  std::array<Magic, SQUARES> magics;
+  std::vector<Bitboard> attacks;
+};
+
+Bitboard magicLookup(SliderTable const& table, int square, Bitboard occupied) {
+  return table.attacks[table.magics[square].index(occupied)];
+}
+
+#if defined(CHESS_PEXT_AVAILABLE)
+CHESS_TARGET_BMI2
+Bitboard pextLookup(SliderTable const& table, int square, Bitboard occupied) {
+  auto const& magic = table.magics[square];
+  return table.attacks[magic.offset +
+                       static_cast<size_t>(_pext_u64(occupied, magic.mask))];
+}
+#endif
+
+using Directions = std::array<std::pair<int, int>, 4>;
+Directions constexpr ROOK_DIRECTIONS = {std::pair(1, 0), std::pair(-1, 0),
+                                        std::pair(0, 1), std::pair(0, -1)};
+Directions constexpr BISHOP_DIRECTIONS = {std::pair(1, 1), std::pair(1, -1),
+                                          std::pair(-1, 1), std::pair(-1, -1)};
+
+/// Computes the attacks of a slider by walking each ray square by square.
+Bitboard slidingAttacks(Directions const& directions, int square,
+                        Bitboard occupied) {
+  Bitboard attacks = 0;
+  for (auto [columnStep, rowStep] : directions) {
+    auto coord = toCoordinates(square);
+    coord.column += columnStep;
+    coord.row += rowStep;
+    while (AbstractBoard::areWithinLimits(coord)) {
+      attacks |= squareMask(coord);
+      if (occupied & squareMask(coord)) {
+        break;
+      }
+      coord.column += columnStep;
+      coord.row += rowStep;
+    }
+  }
+  return attacks;
+}
+
+/**
+  Returns the squares whose occupancy affects the attacks of a slider. The last
+  square of each ray is excluded, since it is attacked whether occupied or not.
+*/
+Bitboard relevantOccupancy(Directions const& directions, int square) {
+  Bitboard mask = 0;
+  for (auto [columnStep, rowStep] : directions) {
+    auto coord = toCoordinates(square);
+    coord.column += columnStep;
+    coord.row += rowStep;
+    auto next = Coordinates(coord.column + columnStep, coord.row + rowStep);
+    while (AbstractBoard::areWithinLimits(next)) {
+      mask |= squareMask(coord);
+      coord = next;
+      next = Coordinates(coord.column + columnStep, coord.row + rowStep);
+    }
+  }
+  return mask;
+}
+
+/// Generates pseudo-random numbers with the xorshift64* algorithm.
+class RandomGenerator {
+public:
+  explicit RandomGenerator(Bitboard seed): m_state(seed) {}
+
+  Bitboard next() {
+    m_state ^= m_state >> 12;
+    m_state ^= m_state << 25;
+    m_state ^= m_state >> 27;
+    return m_state * 2685821657736338717ULL;
+  }
+
+  /// Returns a number with roughly 1/8 of its bits set, as magics tend to be.
+  Bitboard sparse() {
+    return next() & next() & next();
+  }
+
+private:
+  Bitboard m_state;
+};
+
+/**
+  Finds a magic for every square by trial and error, then fills the attacks
+  table. The generator is seeded with constants, so the search always ends
+  with the same magics.
+*/
+SliderTable buildSliderTable(Directions const& directions) {
+  SliderTable table;
+  // seeds known to find the magics of each row quickly
+  std::array<Bitboard, BOARD_SIDE> constexpr seeds = {728, 10316, 55013, 32803,
+                                                      12281, 15100, 16645, 255};
+  std::vector<Bitboard> occupancies;
+  std::vector<Bitboard> references;
+  // remembers which attempt last wrote an entry, to avoid clearing it
+  std::vector<int> lastAttempt;
+  int attempt = 0;
+
+  for (int square = 0; square < SQUARES; ++square) {
+    RandomGenerator random(seeds[toCoordinates(square).row]);
+    auto& magic = table.magics[square];
+    magic.mask = relevantOccupancy(directions, square);
+    magic.shift = static_cast<unsigned>(SQUARES - popCount(magic.mask));
+    magic.offset = table.attacks.size();
+
+    // enumerate all subsets of the mask with the Carry-Rippler trick
+    occupancies.clear();
+    references.clear();
+    Bitboard subset = 0;
+    do {
+      occupancies.push_back(subset);
+      references.push_back(slidingAttacks(directions, square, subset));
+      subset = (subset - magic.mask) & magic.mask;
+    } while (subset != 0);
+
+    table.attacks.resize(magic.offset + occupancies.size());
+    lastAttempt.resize(table.attacks.size(), 0);
+
+    bool found = false;
+    while (!found) {
+      magic.magic = random.sparse();
+      // discard candidates unlikely to spread the mask over the top bits
+      if (popCount((magic.mask * magic.magic) >> (SQUARES - 8)) < 6) {
+        continue;
+      }
+
+      ++attempt;
+      found = true;
+      for (size_t i = 0; i < occupancies.size() && found; ++i) {
+        auto index = magic.index(occupancies[i]);
+        if (lastAttempt[index] != attempt) {
+          lastAttempt[index] = attempt;
+          table.attacks[index] = references[i];
+        } else if (table.attacks[index] != references[i]) {
+          found = false;
+        }
+      }
+    }
+  }
+  return table;
+}
+
+/**
+  Fills the attacks table to be indexed with PEXT, which packs the relevant
+  occupancy into the lowest bits, so no magics have to be searched.
+*/
+SliderTable buildPextSliderTable(Directions const& directions) {
+  SliderTable table;
+  for (int square = 0; square < SQUARES; ++square) {
+    auto& magic = table.magics[square];
+    magic.mask = relevantOccupancy(directions, square);
+    magic.offset = table.attacks.size();
+    // the Carry-Rippler trick enumerates the subsets in order of their PEXT
+    Bitboard subset = 0;
+    do {
+      table.attacks.push_back(slidingAttacks(directions, square, subset));
+      subset = (subset - magic.mask) & magic.mask;
+    } while (subset != 0);
+  }
+  return table;
+}
+
+/**
+  Returns the instruction set with the fastest slider kernel the CPU runs.
+  Hosts without BMI2 use magics, as do builds for other architectures.
+*/
+InstructionSet sliderInstructionSet() {
+#if defined(CHESS_PEXT_AVAILABLE)
+  if (isSupported(InstructionSet::Bmi2)) {
+    return InstructionSet::Bmi2;
+  }
+#endif
+  return InstructionSet::Portable;
+}
+
+/**
+  Returns the table of the slider moving in the given directions, with the
+  kernel of the instruction set given. Sets with no slider kernel of their
+  own use the portable one. Throws if the CPU does not support the set.
+*/
+template <Directions const& directions>
+SliderTable const& sliderTable(InstructionSet set) {
+  if (!isSupported(set)) {
+    throw std::invalid_argument("The CPU does not support the instructions");
+  }
+#if defined(CHESS_PEXT_AVAILABLE)
+  if (set == InstructionSet::Bmi2) {
+    static SliderTable const table = buildPextSliderTable(directions);
+    return table;
+  }
+#endif
+  static SliderTable const table = buildSliderTable(directions);
+  return table;
+}
+
+#if defined(CHESS_PEXT_AVAILABLE)
+/// Defines whether slider lookups use PEXT, decided once at startup.
+bool const USE_PEXT = sliderInstructionSet() == InstructionSet::Bmi2;
+#endif
+
+/**
+  Returns the attacks of the slider moving in the given directions, with the
+  kernel chosen at startup. The branch always goes the same way, so it is
+  predicted, and the magic kernel is inlined rather than called indirectly.
+*/
+template <Directions const& directions>
+Bitboard sliderAttacks(int square, Bitboard occupied) {
+#if defined(CHESS_PEXT_AVAILABLE)
+  if (USE_PEXT) {
+    static SliderTable const& table =
+                              sliderTable<directions>(InstructionSet::Bmi2);
+    return pextLookup(table, square, occupied);
+  }
+#endif
+  static SliderTable const& table =
+                              sliderTable<directions>(InstructionSet::Portable);
+  return magicLookup(table, square, occupied);
+}
+
+/// Returns the attacks of the slider with the kernel of the set given.
+template <Directions const& directions>
+Bitboard sliderAttacks(int square, Bitboard occupied, InstructionSet set) {
+  auto const& table = sliderTable<directions>(set);
+#if defined(CHESS_PEXT_AVAILABLE)
+  if (set == InstructionSet::Bmi2) {
+    return pextLookup(table, square, occupied);
+  }
+#endif
+  return magicLookup(table, square, occupied);
+}
+
+Bitboard rookAttacks(int square, Bitboard occupied) {
+  return sliderAttacks<ROOK_DIRECTIONS>(square, occupied);
+}
+
+Bitboard bishopAttacks(int square, Bitboard occupied) {
+  return sliderAttacks<BISHOP_DIRECTIONS>(square, occupied);
+}
+
+Bitboard rookAttacks(int square, Bitboard occupied, InstructionSet set) {
+  return sliderAttacks<ROOK_DIRECTIONS>(square, occupied, set);
+}
+
+Bitboard bishopAttacks(int square, Bitboard occupied, InstructionSet set) {
+  return sliderAttacks<BISHOP_DIRECTIONS>(square, occupied, set);
+}
+
+Bitboard queenAttacks(int square, Bitboard occupied) {
+  return rookAttacks(square, occupied) | bishopAttacks(square, occupied);
+}
+
+}
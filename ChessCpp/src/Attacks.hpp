@@ -0,0 +1,109 @@
+#ifndef CHESS_ATTACKS
+#define CHESS_ATTACKS
+
+#include <array>
+#include "Bitboard.hpp"
+#include "Cpu.hpp"
+#include <utility>
+
+namespace Chess {
+
+/**
+  Returns the squares attacked by a rook on the given square, where occupied
+  contains every piece on the board. The first piece met in each direction is
+  included, regardless of its colour.
+*/
+Bitboard rookAttacks(int square, Bitboard occupied);
+
+/**
+  Returns the squares attacked by a bishop on the given square, where occupied
+  contains every piece on the board. The first piece met in each direction is
+  included, regardless of its colour.
+*/
+Bitboard bishopAttacks(int square, Bitboard occupied);
+
+/**
+  Returns the squares attacked by a rook, as above, computed with the kernel
+  of the given instruction set rather than the fastest one available. Every
+  kernel gives the same result. Sets with no kernel of their own use the
+  portable one. Throws std::invalid_argument if the CPU lacks the set.
+*/
+Bitboard rookAttacks(int square, Bitboard occupied, InstructionSet set);
+
+/**
+  Returns the squares attacked by a bishop, computed with the kernel of the
+  given instruction set, as described for rooks.
+*/
+Bitboard bishopAttacks(int square, Bitboard occupied, InstructionSet set);
+
+/// Returns the squares attacked by a queen, as a rook and a bishop combined.
+Bitboard queenAttacks(int square, Bitboard occupied);
+
+/// Contains the squares attacked from each square by a piece of fixed steps.
+using LeaperTable = std::array<Bitboard, BOARD_SIDE * BOARD_SIDE>;
+
+/// Builds the attacks of a piece moving by the given (column, row) steps.
+template <size_t N>
+constexpr LeaperTable buildLeaperTable(
+                            std::array<std::pair<int, int>, N> const& steps) {
+  LeaperTable table{};
+  for (int square = 0; square < BOARD_SIDE * BOARD_SIDE; ++square) {
+    auto source = toCoordinates(square);
+    for (auto const& step : steps) {
+      auto column = source.column + step.first;
+      auto row = source.row + step.second;
+      if (column >= 0 && column < BOARD_SIDE && row >= 0 && row < BOARD_SIDE) {
+        table[square] |= squareMask(Coordinates(column, row));
+      }
+    }
+  }
+  return table;
+}
+
+/// Defines the squares attacked by a knight, built at compile time.
+inline LeaperTable constexpr KNIGHT_ATTACKS = buildLeaperTable(std::array{
+    std::pair(1, 2), std::pair(2, 1), std::pair(2, -1), std::pair(1, -2),
+    std::pair(-1, -2), std::pair(-2, -1), std::pair(-2, 1), std::pair(-1, 2)});
+
+/// Defines the squares attacked by a king, built at compile time.
+inline LeaperTable constexpr KING_ATTACKS = buildLeaperTable(std::array{
+    std::pair(1, 1), std::pair(1, 0), std::pair(1, -1), std::pair(0, -1),
+    std::pair(-1, -1), std::pair(-1, 0), std::pair(-1, 1), std::pair(0, 1)});
+
+/// Defines the squares attacked by a pawn of the given colour.
+template <Colour colour>
+inline LeaperTable constexpr PAWN_ATTACKS = buildLeaperTable(std::array{
+    std::pair(-1, colour == Colour::White ? 1 : -1),
+    std::pair(1, colour == Colour::White ? 1 : -1)});
+
+/// Returns the squares attacked by a knight on the given square.
+constexpr Bitboard knightAttacks(int square) {
+  return KNIGHT_ATTACKS[square];
+}
+
+/// Returns the squares attacked by a king on the given square.
+constexpr Bitboard kingAttacks(int square) {
+  return KING_ATTACKS[square];
+}
+
+/**
+  Returns the squares attacked by a pawn of the given colour, as below, with
+  the colour known at compile time.
+*/
+template <Colour colour>
+constexpr Bitboard pawnAttacks(int square) {
+  return PAWN_ATTACKS<colour>[square];
+}
+
+/**
+  Returns the squares attacked by a pawn of the given colour on the given
+  square, i.e. the squares one step diagonally forward.
+*/
+constexpr Bitboard pawnAttacks(Colour colour, int square) {
+  return (colour == Colour::White) ? pawnAttacks<Colour::White>(square) :
+                                     pawnAttacks<Colour::Black>(square);
+}
+
+}
+
+#endif // CHESS_ATTACKS
@@ -8,24 +8,28 @@ std::vector<Coordinates> const Bishop::WHITE_STD_INIT =
 std::vector<Coordinates> const Bishop::BLACK_STD_INIT =
                                          {Coordinates(2, 7), Coordinates(5, 7)};
 
-Bishop::Bishop(Colour colour, AbstractBoard& board): 
-                                                PromotionPiece(colour, board) {}
+Bishop::Bishop(Colour colour): PromotionPiece(colour) {}
 
 std::string Bishop::name() const {
   return "Bishop";
 }
 
-bool Bishop::isNormalMoveSpecific(Coordinates const& source,
-                               Coordinates const& destination) const {
+PieceType Bishop::type() const {
+  return PieceType::Bishop;
+}
+
+bool Bishop::isNormalMoveSpecific(AbstractBoard const& board,
+                                  Coordinates const& source,
+                                  Coordinates const& destination) const {
   if (source.sameDiagonalAs(destination)) {
-    return getBoard().isFreeDiagonal(source, destination);
+    return board.isFreeDiagonal(source, destination);
   }
   return false;
 }
 
-MoveResult Bishop::move(Coordinates const& source, 
+MoveResult Bishop::move(AbstractBoard& board, Coordinates const& source,
                         Coordinates const& destination) {
-  return getMutableBoard().move(*this, source, destination);
+  return board.move(*this, source, destination);
 }
 
 }
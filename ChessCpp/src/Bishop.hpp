@@ -20,23 +20,27 @@ class Bishop final: public PromotionPiece {
   */
   static std::vector<Coordinates> const BLACK_STD_INIT;
 
-  /// Constructs a bishop of the given colour and associated to a board.
-  Bishop(Colour colour, AbstractBoard& board);
+  /// Constructs a bishop of the given colour.
+  Bishop(Colour colour);
 
   //! @copydoc AbstractBoard::move(Pawn&,Coordinates const&,Coordinates const&)
-  MoveResult move(Coordinates const& source, 
-                          Coordinates const& destination) override;
+  MoveResult move(AbstractBoard& board, Coordinates const& source,
+                  Coordinates const& destination) override;
 
   /// Returns "Bishop".
   std::string name() const override;
 
+  /// Returns PieceType::Bishop.
+  PieceType type() const override;
+
   private:
   /**
    Checks for bishop-specific moves and returns true if the given move
    is valid in the associated board.
   */
-  bool isNormalMoveSpecific(Coordinates const& source,
-                           Coordinates const& destination) const override;
+  bool isNormalMoveSpecific(AbstractBoard const& board,
+                            Coordinates const& source,
+                            Coordinates const& destination) const override;
 };
 
 }
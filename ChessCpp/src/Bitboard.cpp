@@ -0,0 +1,77 @@
+#include <array>
+#include "Bitboard.hpp"
+
+namespace Chess {
+
+using BetweenTable = std::array<std::array<Bitboard, BOARD_SIDE * BOARD_SIDE>,
+                                                     BOARD_SIDE * BOARD_SIDE>;
+
+BetweenTable buildBetweenTable() {
+  BetweenTable table{};
+  for (int source = 0; source < BOARD_SIDE * BOARD_SIDE; ++source) {
+    for (int columnStep = -1; columnStep <= 1; ++columnStep) {
+      for (int rowStep = -1; rowStep <= 1; ++rowStep) {
+        if (columnStep == 0 && rowStep == 0) {
+          continue;
+        }
+
+        // walk away from the source, remembering the squares crossed so far
+        Bitboard crossed = 0;
+        auto coord = toCoordinates(source);
+        coord.column += columnStep;
+        coord.row += rowStep;
+        while (AbstractBoard::areWithinLimits(coord)) {
+          table[source][toSquare(coord)] = crossed;
+          crossed |= squareMask(coord);
+          coord.column += columnStep;
+          coord.row += rowStep;
+        }
+      }
+    }
+  }
+  return table;
+}
+
+BetweenTable buildLineTable() {
+  BetweenTable table{};
+  for (int source = 0; source < BOARD_SIDE * BOARD_SIDE; ++source) {
+    for (int destination = 0; destination < BOARD_SIDE * BOARD_SIDE;
+                                                            ++destination) {
+      auto from = toCoordinates(source);
+      auto to = toCoordinates(destination);
+      if (source == destination ||
+          !(from.sameRowAs(to) || from.sameColumnAs(to) ||
+            from.sameDiagonalAs(to))) {
+        continue;
+      }
+
+      // walk from the first edge met backwards up to the opposite edge
+      int columnStep = (to.column > from.column) - (to.column < from.column);
+      int rowStep = (to.row > from.row) - (to.row < from.row);
+      auto coord = from;
+      while (AbstractBoard::areWithinLimits(
+               Coordinates(coord.column - columnStep, coord.row - rowStep))) {
+        coord.column -= columnStep;
+        coord.row -= rowStep;
+      }
+      while (AbstractBoard::areWithinLimits(coord)) {
+        table[source][destination] |= squareMask(coord);
+        coord.column += columnStep;
+        coord.row += rowStep;
+      }
+    }
+  }
+  return table;
+}
+
+Bitboard between(int source, int destination) {
+  static BetweenTable const table = buildBetweenTable();
+  return table[source][destination];
+}
+
+Bitboard line(int source, int destination) {
+  static BetweenTable const table = buildLineTable();
+  return table[source][destination];
+}
+
+}
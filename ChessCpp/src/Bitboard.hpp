@@ -0,0 +1,115 @@
+#ifndef CHESS_BITBOARD
+#define CHESS_BITBOARD
+
+#include "AbstractBoard.hpp"
+#include <cstdint>
+#include "Utils.hpp"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Chess {
+
+/**
+  Represents a set of squares, where each bit corresponds to a square.
+  The least significant bit is A1, the next one B1 and so on up to H8.
+*/
+using Bitboard = std::uint64_t;
+
+/// Defines the number of squares in a row (or column) of the board.
+int constexpr BOARD_SIDE = AbstractBoard::MAX_COL_NUM + 1;
+
+/// Converts coordinates into a square index (e.g. 0,0 to 0 and 7,7 to 63).
+constexpr int toSquare(Coordinates const& coord) {
+  return coord.row * BOARD_SIDE + coord.column;
+}
+
+/// Converts a square index into coordinates (e.g. 63 to 7,7).
+constexpr Coordinates toCoordinates(int square) {
+  return Coordinates(square % BOARD_SIDE, square / BOARD_SIDE);
+}
+
+/// Returns a bitboard containing only the given square.
+constexpr Bitboard squareMask(int square) {
+  return Bitboard(1) << square;
+}
+
+/// Returns a bitboard containing only the square at the given coordinates.
+constexpr Bitboard squareMask(Coordinates const& coord) {
+  return squareMask(toSquare(coord));
+}
+
+/// Returns the number of squares in the bitboard.
+inline int popCount(Bitboard bitboard) {
+#if defined(_MSC_VER)
+  return static_cast<int>(__popcnt64(bitboard));
+#else
+  return __builtin_popcountll(bitboard);
+#endif
+}
+
+/// Returns the index of the lowest square in a non-empty bitboard.
+inline int lowestSquare(Bitboard bitboard) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward64(&index, bitboard);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctzll(bitboard);
+#endif
+}
+
+/// Removes the lowest square from a non-empty bitboard and returns its index.
+inline int popLowestSquare(Bitboard& bitboard) {
+  int square = lowestSquare(bitboard);
+  bitboard &= bitboard - 1;
+  return square;
+}
+
+/// Returns the squares of the given row.
+constexpr Bitboard rowMask(int row) {
+  return Bitboard(0xFF) << (row * BOARD_SIDE);
+}
+
+/**
+  Returns the row given as counted by the player of the given colour, e.g.
+  row 1 is the starting row of the pawns of either player.
+*/
+template <Colour colour>
+constexpr int relativeRow(int row) {
+  return colour == Colour::White ? row : BOARD_SIDE - 1 - row;
+}
+
+/// Defines the offset from a square to the one in front of it for a colour.
+template <Colour colour>
+int constexpr FORWARD = colour == Colour::White ? BOARD_SIDE : -BOARD_SIDE;
+
+/**
+  Returns the squares one row forward for the player of the given colour.
+  Squares pushed beyond the board are dropped.
+*/
+template <Colour colour>
+constexpr Bitboard pushed(Bitboard squares) {
+  if constexpr (colour == Colour::White) {
+    return squares << BOARD_SIDE;
+  } else {
+    return squares >> BOARD_SIDE;
+  }
+}
+
+/**
+  Returns the squares strictly between the two given squares, provided they
+  share a row, a column or a diagonal. Returns an empty bitboard otherwise.
+*/
+Bitboard between(int source, int destination);
+
+/**
+  Returns the whole row, column or diagonal shared by the two given squares,
+  from edge to edge of the board and including both squares.
+  Returns an empty bitboard if the squares are not aligned or are the same.
+*/
+Bitboard line(int source, int destination);
+
+}
+
+#endif // CHESS_BITBOARD
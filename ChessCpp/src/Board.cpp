@@ -1,3 +1,5 @@
+#include <algorithm>
+#include "Attacks.hpp"
 #include "Bishop.hpp"
 #include "Board.hpp"
 #include <iomanip>
@@ -9,78 +11,119 @@
 #include "Rook.hpp"
 #include <stdexcept>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 #include "Zobrist.hpp"
 
 /// Defines the number of squares the king travels to castle.
 int constexpr CASTLE_DISTANCE = 2;
 /// Defines the horizontal printing space used for a square of the board.
 int constexpr H_PRINT_SIZE = 15;
+/// Defines the bits counting the pieces of one type in a material signature.
+int constexpr MATERIAL_BITS = 4;
 
 namespace Chess {
 
+/// Returns the material signature of a single piece of the given type.
+constexpr std::uint32_t materialOf(PieceType type) {
+  return std::uint32_t(1) << (static_cast<int>(type) * MATERIAL_BITS);
+}
+
+/// Lists the material of a side unable to checkmate, whatever the other has.
+std::array<std::uint32_t, 3> constexpr DEAD_MATERIAL = {
+  materialOf(PieceType::King),
+  materialOf(PieceType::King) + materialOf(PieceType::Knight),
+  materialOf(PieceType::King) + materialOf(PieceType::Bishop)
+};
+
+/// Returns the index of the bitboard for the given colour and piece type.
+size_t bitboardIndex(Colour colour, PieceType type) {
+  return static_cast<size_t>(colour) * (static_cast<size_t>(PieceType::King) + 1)
+         + static_cast<size_t>(type);
+}
+
 struct Board::PastMove {
   PastMove(Board const& board,
            Coordinates const& source,
            Coordinates const& destination,
            bool sourceMoved,
-           std::unique_ptr<Piece> removedPiece = nullptr):
+           PieceIndex removedPiece = NO_PIECE):
                      PastMove(board, source, destination, sourceMoved,
-                                      std::move(removedPiece), destination) {}
+                                      removedPiece, destination) {}
 
   PastMove(Board const& board,
            Coordinates const& source,
            Coordinates const& destination,
            bool sourceMoved,
-           std::unique_ptr<Piece> capturedPiece,
+           PieceIndex capturedPiece,
            Coordinates const& capturedCoords):
               source(source),
               destination(destination), 
               sourceMovedStatus(sourceMoved),
               removedPieceCoords(capturedCoords),
-              removedPiece(std::move(capturedPiece)),
+              removedPiece(capturedPiece),
               isWhiteTurn(board.m_isWhiteTurn),
               promotionSource(board.m_promotionSource),
-              boardHashCount(board.m_boardHashCount),
               countSincePawnMoveOrCapture(board.m_countSincePawnMoveOrCapture),
-              threeFoldRepetition(board.m_threeFoldRepetition),
-              insufficientMaterial(board.m_insufficientMaterial) {}
+              threeFoldRepetition(board.m_threeFoldRepetition) {}
 
   Coordinates source;
   Coordinates destination;
   bool sourceMovedStatus = false;
 
   Coordinates removedPieceCoords;
-  std::unique_ptr<Piece> removedPiece = nullptr;
+  // the slot of the piece removed, which stays allocated for the undo
+  PieceIndex removedPiece = NO_PIECE;
 
   bool isWhiteTurn = false;
   std::optional<Coordinates> promotionSource;
-  std::unordered_map<int, size_t> boardHashCount;
   int countSincePawnMoveOrCapture = 0;
   bool threeFoldRepetition = false;
-  std::unordered_set<std::reference_wrapper<Piece>,
-                                          PieceRefHasher> insufficientMaterial;
+  // whether the move appended the key of the position it reached
+  bool addedPositionKey = false;
+};
+
+/**
+  Describes what threatens a king, so that the legality of a move can be
+  established without playing it.
+*/
+struct Board::KingSafety {
+  int kingSquare = 0;
+  // pieces which would expose the king by leaving the line of their pinner
+  Bitboard pinned = 0;
+  // squares where a piece other than the king must land to stop a check
+  Bitboard evasions = ~Bitboard(0);
 };
 
 Coordinates Board::stringToCoordinates(std::string_view coord) {
+  if (auto reason = invalidCoordinatesReason(coord)) {
+    if (coord.size() != 2) {
+      throw std::invalid_argument(*reason);
+    }
+    throw std::out_of_range(*reason);
+  }
+  return *parseCoordinates(coord);
+}
+
+std::optional<std::string> Board::invalidCoordinatesReason(
+                                                    std::string_view coord) {
   if (coord.size() != 2) {
-    throw std::invalid_argument(std::string(coord) + 
-      std::string(" is an invalid coordinate pair. Size must be 2"));
+    return std::string(coord) +
+      std::string(" is an invalid coordinate pair. Size must be 2");
   }
 
   if (coord[0] < MIN_COLUMN || coord[0] > MAX_COLUMN) {
-    throw std::out_of_range(std::string(coord) +
+    return std::string(coord) +
       std::string(" is an invalid coordinate pair. Column must be within ") +
-        MIN_COLUMN + std::string(" and ") + MAX_COLUMN);
+        MIN_COLUMN + std::string(" and ") + MAX_COLUMN;
   }
 
   if (coord[1] < MIN_ROW || coord[1] > MAX_ROW) {
-    throw std::out_of_range(std::string(coord) +
+    return std::string(coord) +
       std::string(" is an invalid coordinate pair. Row must be within ") +
-        MIN_ROW + std::string(" and ") + MAX_ROW);
+        MIN_ROW + std::string(" and ") + MAX_ROW;
   }
-
-  return Coordinates(static_cast<int>(coord[0] - MIN_COLUMN),
-                     static_cast<int>(coord[1] - MIN_ROW));
+  return std::nullopt;
 }
 
 std::string Board::coordinatesToString(Coordinates const& coord) {
@@ -100,13 +143,66 @@ bool Board::isGameOver() const {
   return m_isGameOver;
 }
 
+BoardHash Board::hash() const {
+  return m_hasher->hash();
+}
+
+Position Board::position() const {
+  if (promotionPending()) {
+    throw std::logic_error("Cannot describe the position while a promotion "
+                           "is pending");
+  }
+
+  Position result;
+  for (auto colour : {Colour::White, Colour::Black}) {
+    for (size_t type = 0; type < result.pieces.size(); ++type) {
+      result.pieces[type] |= pieces(colour, static_cast<PieceType>(type));
+    }
+  }
+  result.colours = m_colourBitboards;
+  auto occupied = m_occupied;
+  while (occupied) {
+    auto square = popLowestSquare(occupied);
+    auto coord = toCoordinates(square);
+    if (!at(coord)->getMovedStatus()) {
+      result.unmoved |= squareMask(square);
+    }
+  }
+  result.countSincePawnMoveOrCapture =
+                    static_cast<std::uint16_t>(m_countSincePawnMoveOrCapture);
+  result.sideToMove = currentPlayer();
+
+  // en passant is only recorded if a pawn can capture, as the hasher does
+  if (!m_movesHistory.empty()) {
+    auto const& lastMove = m_movesHistory.back();
+    auto const& destination = lastMove.destination;
+    auto piece = at(destination);
+    if (piece != nullptr && piece->type() == PieceType::Pawn &&
+        !lastMove.sourceMovedStatus &&
+        abs(destination.row - lastMove.source.row) == 2) {
+      Bitboard sides = 0;
+      for (auto column : {destination.column - 1, destination.column + 1}) {
+        if (areWithinLimits(Coordinates(column, destination.row))) {
+          sides |= squareMask(Coordinates(column, destination.row));
+        }
+      }
+      if (sides & pieces(currentPlayer(), PieceType::Pawn)) {
+        result.enPassantFile = static_cast<std::int8_t>(destination.column);
+      }
+    }
+  }
+  result.key = result.computeKey();
+  return result;
+}
+
 Board::Board(): Board(std::make_unique<ZobristHasher>()) {}
 
 Board::Board(std::unique_ptr<BoardHasher> hasher): m_hasher(std::move(hasher)) {
   if (this->m_hasher == nullptr) {
     throw std::invalid_argument("The board hasher cannot be null");
   }
-  initializePiecesInStandardPos();
+  copyStandardPieces();
+  m_positionKeys.push_back(m_hasher->hash());
 }
 
 Board::Board(std::vector<Coordinates> const& whitePawns,
@@ -136,43 +232,185 @@ Board::Board(std::vector<Coordinates> const& whitePawns,
     initializeQueens(colour == Colour::White ? whiteQueens : blackQueens, colour);
     initializeKing(colour == Colour::White ? whiteKing : blackKing, colour);
   }
+  m_positionKeys.push_back(m_hasher->hash());
   checkGameState();
 }
 
+Board::Board(Position const& position):
+                          m_hasher(std::make_unique<ZobristHasher>(position)) {
+  reset(position);
+}
+
 Board::Board(Board&& other) noexcept {
   operator=(std::move(other));
 }
 
 Board& Board::operator=(Board&& other) noexcept {
+  // pieces do not refer to their board, so they are handed over as they are
   m_isGameOver = other.m_isGameOver;
   m_isWhiteTurn = other.m_isWhiteTurn;
   m_promotionSource = std::move(other.m_promotionSource);
-  m_board = std::move(other.m_board);
-  m_kings = std::move(other.m_kings);
+  m_pieces = std::move(other.m_pieces);
+  m_piecesCount = other.m_piecesCount;
+  m_board = other.m_board;
+  m_pieceBitboards = other.m_pieceBitboards;
+  m_colourBitboards = other.m_colourBitboards;
+  m_occupied = other.m_occupied;
+  m_material = other.m_material;
   m_hasher = std::move(other.m_hasher);
-  m_boardHashCount = std::move(other.m_boardHashCount);;
+  m_positionKeys = std::move(other.m_positionKeys);
   m_threeFoldRepetition = other.m_threeFoldRepetition;
-  m_countSincePawnMoveOrCapture = other.m_threeFoldRepetition;
-  m_insufficientMaterial = std::move(other.m_insufficientMaterial);
+  m_countSincePawnMoveOrCapture = other.m_countSincePawnMoveOrCapture;
   m_movesHistory = std::move(other.m_movesHistory);
+  return *this;
+}
 
-  for (auto& column: m_board) {
-    for (auto& piece: column) {
-      if (piece != nullptr) {
-        // assign existing pieces to the current Board object
-        piece->setBoard(*this);
-      }
+/**
+  Returns the source and destination of the double step which granted the
+  right to capture en passant in the position given.
+*/
+std::pair<Coordinates, Coordinates> enPassantDoubleStep(
+                                                   Position const& position) {
+  auto enemy = opponentOf(position.sideToMove);
+  auto forward = (enemy == Colour::White) ? 1 : -1;
+  Coordinates destination(position.enPassantFile,
+                          enemy == Colour::White ? 3 : Board::MAX_ROW_NUM - 3);
+  Coordinates source(destination.column, destination.row - 2 * forward);
+  return {source, destination};
+}
+
+void Board::reset(Position const& position) {
+  ensureIsValid(position);
+  if (position.enPassantFile == Position::NO_EN_PASSANT) {
+    initializePieces(position);
+    return;
+  }
+
+  // en passant relies on the last move, so the double step is played again
+  auto enemy = opponentOf(position.sideToMove);
+  auto [source, destination] = enPassantDoubleStep(position);
+  auto destinationMask = squareMask(destination);
+  auto sourceMask = squareMask(source);
+  auto previous = position;
+  auto pawnIndex = static_cast<size_t>(PieceType::Pawn);
+  previous.pieces[pawnIndex] ^= destinationMask | sourceMask;
+  previous.colours[static_cast<size_t>(enemy)] ^= destinationMask | sourceMask;
+  previous.unmoved = (previous.unmoved & ~destinationMask) | sourceMask;
+  previous.enPassantFile = Position::NO_EN_PASSANT;
+  previous.sideToMove = enemy;
+  // the double step zeroes the count, which is restored once it is replayed
+  previous.countSincePawnMoveOrCapture = 0;
+  previous.key = previous.computeKey();
+  initializePieces(previous);
+  move(source, destination);
+  m_countSincePawnMoveOrCapture = position.countSincePawnMoveOrCapture;
+}
+
+void Board::ensureIsValid(Position const& position) {
+  Bitboard pieces = 0;
+  int count = 0;
+  for (auto const& squares : position.pieces) {
+    pieces |= squares;
+    count += popCount(squares);
+  }
+  if (pieces != position.occupied() || count != popCount(pieces) ||
+      (position.colours[0] & position.colours[1])) {
+    throw std::invalid_argument("Cannot initialize board with two or more"
+                                " pieces in the same coordinates");
+  }
+
+  Bitboard constexpr firstRow = 0xFF;
+  auto lastRows = firstRow | firstRow << (MAX_ROW_NUM * BOARD_SIDE);
+  if (position.pieces[static_cast<size_t>(PieceType::Pawn)] & lastRows) {
+    throw std::invalid_argument("Pawns cannot be in the first or last row");
+  }
+
+  for (auto colour : {Colour::White, Colour::Black}) {
+    if (popCount(position.piecesOf(colour, PieceType::King)) != 1) {
+      throw std::invalid_argument("There must be exactly one king per colour");
     }
   }
 
-  for (auto& pastMove : m_movesHistory) {
-    if (pastMove.removedPiece) {
-      // assign removed pieces to the current Board object
-      pastMove.removedPiece->setBoard(*this);
+  // a position grants double steps by row, the board by moved status
+  auto startingRows = rowMask(relativeRow<Colour::White>(1)) &
+                      position.colours[static_cast<size_t>(Colour::White)];
+  startingRows |= rowMask(relativeRow<Colour::Black>(1)) &
+                  position.colours[static_cast<size_t>(Colour::Black)];
+  auto pawns = position.pieces[static_cast<size_t>(PieceType::Pawn)];
+  if ((pawns & position.unmoved) != (pawns & startingRows)) {
+    throw std::invalid_argument("Pawns are unmoved if and only if they are in"
+                                " their starting row");
+  }
+
+  if (position.enPassantFile != Position::NO_EN_PASSANT) {
+    // the double step is replayed on reset, so it must have been legal
+    auto enemy = opponentOf(position.sideToMove);
+    auto [source, destination] = enPassantDoubleStep(position);
+    auto enemyKing = lowestSquare(position.piecesOf(enemy, PieceType::King));
+    if ((position.piecesOf(enemy, PieceType::Pawn) &
+                                              squareMask(destination)) == 0 ||
+        (position.occupied() &
+         (squareMask(source) | between(toSquare(source),
+                                       toSquare(destination)))) ||
+        position.attackersTo(enemyKing, position.sideToMove,
+                             position.occupied()) != 0) {
+      throw std::invalid_argument("The position does not follow a legal double"
+                                  " step of a pawn in the en passant column");
     }
   }
+}
 
-  return *this;
+void Board::initializePieces(Position const& position) {
+  clearGame();
+  m_hasher->reset(position);
+  for (auto colour : {Colour::White, Colour::Black}) {
+    auto piecesOf = [&](PieceType type) {
+      return position.piecesOf(colour, type);
+    };
+    auto unmoved = position.unmoved;
+    placePieces<Pawn>(piecesOf(PieceType::Pawn), colour, unmoved);
+    placePieces<Rook>(piecesOf(PieceType::Rook), colour, unmoved);
+    placePieces<Knight>(piecesOf(PieceType::Knight), colour, unmoved);
+    placePieces<Bishop>(piecesOf(PieceType::Bishop), colour, unmoved);
+    placePieces<Queen>(piecesOf(PieceType::Queen), colour, unmoved);
+    placePieces<King>(piecesOf(PieceType::King), colour, unmoved);
+  }
+
+  m_isWhiteTurn = position.sideToMove == Colour::White;
+  m_countSincePawnMoveOrCapture = position.countSincePawnMoveOrCapture;
+  m_positionKeys.push_back(m_hasher->hash());
+  // the game state is evaluated for the opponent of the current player
+  togglePlayer();
+  checkGameState();
+  togglePlayer();
+}
+
+template <typename Chessman>
+void Board::placePieces(Bitboard squares, Colour colour, Bitboard unmoved) {
+  while (squares) {
+    auto square = popLowestSquare(squares);
+    auto coord = toCoordinates(square);
+    auto index = addPiece<Chessman>(colour);
+    pieceAt(index).setMovedStatus((unmoved & squareMask(square)) == 0);
+    addToBitboards(index, coord);
+    indexAt(coord) = index;
+  }
+}
+
+void Board::clearGame() {
+  m_countSincePawnMoveOrCapture = 0;
+  m_promotionSource.reset();
+  m_positionKeys.clear();
+  m_isWhiteTurn = true;
+  m_isGameOver = false;
+  m_threeFoldRepetition = false;
+  m_board = emptySquares();
+  m_piecesCount = 0;
+  m_pieceBitboards.fill(0);
+  m_colourBitboards.fill(0);
+  m_occupied = 0;
+  m_material.fill(0);
+  m_movesHistory.clear();
 }
 
 void Board::initializePawns(std::vector<Coordinates> const& coords,
@@ -213,9 +451,7 @@ void Board::initializeKnights(std::vector<Coordinates> const& coords,
       auto& coords = (colour == Colour::White ? Knight::WHITE_STD_INIT :
                                                 Knight::BLACK_STD_INIT);
       return std::find(coords.begin(), coords.end(), coord) != coords.end();
-    },
-    [this](auto& piece) { m_insufficientMaterial.emplace(piece); }
-  );
+    });
 }
 
 void Board::initializeBishops(std::vector<Coordinates> const& coords,
@@ -225,9 +461,7 @@ void Board::initializeBishops(std::vector<Coordinates> const& coords,
         auto& coords = (colour == Colour::White ? Bishop::WHITE_STD_INIT :
                                                   Bishop::BLACK_STD_INIT);
         return std::find(coords.begin(), coords.end(), coord) != coords.end();
-    },
-    [this](auto& piece) { m_insufficientMaterial.emplace(piece); }
-  );
+    });
 }
 
 void Board::initializeQueens(std::vector<Coordinates> const& coords,
@@ -244,10 +478,6 @@ void Board::initializeKing(Coordinates const& coords, Colour colour) {
         [&](Coordinates const& coord) { 
             return coord == (colour == Colour::White ? King::WHITE_STD_INIT :
                                                        King::BLACK_STD_INIT);
-        },
-        [&](King& king) {
-            m_insufficientMaterial.emplace(king);
-            m_kings.emplace(colour, king);
         });
 }
 
@@ -255,15 +485,6 @@ template <typename Chessman, typename Predicate>
 void Board::initializePieces(std::vector<Coordinates> const& coords,
                              Colour colour,
                              Predicate&& isStandardStartingPos) {
-  initializePieces<Chessman>(coords, colour, isStandardStartingPos,
-                             [](auto const&) {});
-}
-
-template <typename Chessman, typename Predicate, typename Callable>
-void Board::initializePieces(std::vector<Coordinates> const& coords,
-                             Colour colour,
-                             Predicate&& isStandardStartingPos,
-                             Callable&& finalActions) {
   for (auto const& coord : coords) {
     if (!areWithinLimits(coord)) {
       throw std::invalid_argument("Coordinates go beyond the board limits");
@@ -273,12 +494,12 @@ void Board::initializePieces(std::vector<Coordinates> const& coords,
                                   " pieces in the same coordinates");
     }
 
-    auto chessman = std::make_unique<Chessman>(colour, *this);
+    auto index = addPiece<Chessman>(colour);
     if (!isStandardStartingPos(coord)) {
-      chessman->setMovedStatus(true);
+      pieceAt(index).setMovedStatus(true);
     }
-    finalActions(*chessman);
-    m_board[coord.column][coord.row] = std::move(chessman);
+    addToBitboards(index, coord);
+    indexAt(coord) = index;
   }
 }
 
@@ -294,71 +515,99 @@ void Board::claimDraw() {
   }
 }
 
-void Board::initializePiecesInStandardPos() {
-  std::array<Colour, 2> colours = {Colour::White, Colour::Black};
-  for (auto const& colour : colours) {
-    initializePawns(colour == Colour::White ? 
-               Pawn::WHITE_STD_INIT : Pawn::BLACK_STD_INIT, colour);
-    initializeRooks(colour == Colour::White ? 
-               Rook::WHITE_STD_INIT : Rook::BLACK_STD_INIT, colour);
-    initializeKnights(colour == Colour::White ? 
-               Knight::WHITE_STD_INIT : Knight::BLACK_STD_INIT, colour);
-    initializeBishops(colour == Colour::White ?
-               Bishop::WHITE_STD_INIT : Bishop::BLACK_STD_INIT, colour);
-    initializeQueens({colour == Colour::White ? 
-               Queen::WHITE_STD_INIT : Queen::BLACK_STD_INIT}, colour);
-    initializeKing(colour == Colour::White ?
-               King::WHITE_STD_INIT : King::BLACK_STD_INIT, colour);
-  }
+void Board::copyStandardPieces() {
+  // the standard pieces are copied from a board set up once for all
+  static Board const start(Pawn::WHITE_STD_INIT, Rook::WHITE_STD_INIT,
+                           Knight::WHITE_STD_INIT, Bishop::WHITE_STD_INIT,
+                           {Queen::WHITE_STD_INIT}, King::WHITE_STD_INIT,
+                           Pawn::BLACK_STD_INIT, Rook::BLACK_STD_INIT,
+                           Knight::BLACK_STD_INIT, Bishop::BLACK_STD_INIT,
+                           {Queen::BLACK_STD_INIT}, King::BLACK_STD_INIT);
+  std::copy_n(start.m_pieces.begin(), start.m_piecesCount, m_pieces.begin());
+  m_piecesCount = start.m_piecesCount;
+  m_board = start.m_board;
+  m_pieceBitboards = start.m_pieceBitboards;
+  m_colourBitboards = start.m_colourBitboards;
+  m_occupied = start.m_occupied;
+  m_material = start.m_material;
 }
 
 void Board::reset() {
-  m_countSincePawnMoveOrCapture = 0;
+  clearGame();
+  copyStandardPieces();
   m_hasher->reset();
-  m_promotionSource.reset();
-  m_boardHashCount.clear();
-  m_isWhiteTurn = true;
-  m_isGameOver = false;
-  m_threeFoldRepetition = false;
-  for (auto& column : m_board) {
-    for (auto& piece : column) {
-      piece.reset();
-    }
-  }
-  m_kings.clear();
-  m_movesHistory.clear();
-  m_insufficientMaterial.clear();
-  initializePiecesInStandardPos();
+  m_positionKeys.push_back(m_hasher->hash());
 }
 
 MoveResult Board::move(std::string_view src, std::string_view destination) {
-  Coordinates sourceCoord;
-  Coordinates targetCoord;
-  try {
-    sourceCoord = stringToCoordinates(src);
-    targetCoord = stringToCoordinates(destination);
-  } catch (std::exception const& e) {
-    throw InvalidMove(e.what(), InvalidMove::ErrorCode::INVALID_COORDINATES);
-  }
-
-  return move(sourceCoord, targetCoord);
+  return tryMove(src, destination).value();
 }
 
 MoveResult Board::move(Coordinates const& src, Coordinates const& destination) {
-  if (at(src) == nullptr) {
-    std::string sourceStr;
-    try {
-      sourceStr = Board::coordinatesToString(src);
-    } catch (std::exception const& e) {
-      throw InvalidMove(e.what(), InvalidMove::ErrorCode::INVALID_COORDINATES);
+  return tryMove(src, destination).value();
+}
+
+MoveResult Board::move(Move const& move) {
+  auto result = this->move(move.source(), move.destination());
+  if (auto promotion = move.promotion()) {
+    if (auto promotionResult = promote(*promotion)) {
+      return *promotionResult;
     }
+    undoLastMove();
+    throw InvalidMove("Only a pawn reaching the last row can be promoted",
+                      InvalidMove::ErrorCode::PIECE_LOGIC_ERROR);
+  }
+  return result;
+}
+
+MoveAttempt Board::tryMove(std::string_view src, std::string_view destination) {
+  auto sourceCoord = parseCoordinates(src);
+  auto targetCoord = parseCoordinates(destination);
+  if (!sourceCoord || !targetCoord) {
+    return MoveAttempt::Error{InvalidMove::ErrorCode::INVALID_COORDINATES,
+                              currentPlayer(), PieceType::Pawn,
+                              sourceCoord.value_or(Coordinates()),
+                              targetCoord.value_or(Coordinates()),
+                              MoveAttempt::InvalidText(sourceCoord ?
+                                                       destination : src)};
+  }
+  return tryMove(*sourceCoord, *targetCoord);
+}
 
-    std::stringstream ss;
-    ss << "There is no piece at position " << sourceStr;
-    throw InvalidMove(ss.str(), InvalidMove::ErrorCode::NO_SOURCE_PIECE);
+MoveAttempt Board::tryMove(Coordinates const& src,
+                           Coordinates const& destination) {
+  if (!areWithinLimits(src)) {
+    return MoveAttempt::Error{InvalidMove::ErrorCode::INVALID_COORDINATES,
+                              currentPlayer(), PieceType::Pawn, src,
+                              destination, std::nullopt};
   }
 
-  return m_board[src.column][src.row]->move(src, destination);
+  auto piece = at(src);
+  if (piece == nullptr) {
+    return MoveAttempt::Error{InvalidMove::ErrorCode::NO_SOURCE_PIECE,
+                              currentPlayer(), PieceType::Pawn, src,
+                              destination, std::nullopt};
+  }
+
+  if (typeOf(indexAt(src)) == PieceType::Pawn) {
+    return tryMove(src, destination,
+      [this](Coordinates const& source, Coordinates const& destination) {
+        movePawn(source, destination);
+      });
+  }
+  return tryMove(src, destination,
+    [this](Coordinates const& source, Coordinates const& destination) {
+      moveNonPawn(source, destination);
+    });
+}
+
+std::optional<Coordinates> Board::parseCoordinates(std::string_view coord) {
+  if (coord.size() != 2 || coord[0] < MIN_COLUMN || coord[0] > MAX_COLUMN ||
+      coord[1] < MIN_ROW || coord[1] > MAX_ROW) {
+    return std::nullopt;
+  }
+  return Coordinates(static_cast<int>(coord[0] - MIN_COLUMN),
+                     static_cast<int>(coord[1] - MIN_ROW));
 }
 
 void Board::ensurePieceIsAtSource(Piece const& piece,
@@ -371,157 +620,139 @@ void Board::ensurePieceIsAtSource(Piece const& piece,
 MoveResult Board::move(Pawn& piece, Coordinates const& source,
                                     Coordinates const& destination) {
   ensurePieceIsAtSource(piece, source);
-  return move(source, destination,
-    [this, &piece] (Coordinates const& source, Coordinates const& destination) {
-      if (isValidEnPassant(piece, source, destination)) {
-          auto toCaptureRow = (destination.row == 2) ? 3 : MAX_ROW_NUM - 3;
-          Coordinates toCapture(destination.column, toCaptureRow);
-          auto& srcPiecePtr = m_board[source.column][source.row];
-          m_movesHistory.emplace_back(*this, source, destination,
-                             srcPiecePtr->getMovedStatus(),
-                             std::move(m_board[toCapture.column][toCapture.row]),
-                             toCapture);
-          srcPiecePtr->setMovedStatus(true);
-          m_board[destination.column][destination.row] = std::move(srcPiecePtr);
-      } else {
-        recordAndMove(source, destination);
-      }
-
-      if ((piece.getColour() == Colour::White &&
-                  destination.row == MAX_ROW_NUM) ||
-          (piece.getColour() == Colour::Black &&
-                              destination.row == 0)) {
-        m_promotionSource = destination;
-      }
-      m_countSincePawnMoveOrCapture = 0;
-  });
+  return tryMove(source, destination,
+    [this](Coordinates const& source, Coordinates const& destination) {
+      movePawn(source, destination);
+    }).value();
 }
 
 MoveResult Board::move(PromotionPiece& piece, Coordinates const& source,
                                               Coordinates const& destination) {
   ensurePieceIsAtSource(piece, source);
-  return move(source, destination,
-    [this] (Coordinates const& source, Coordinates const& destination) {
-      recordAndMove(source, destination);
-      ++m_countSincePawnMoveOrCapture;
-    });
+  return tryMove(source, destination,
+    [this](Coordinates const& source, Coordinates const& destination) {
+      moveNonPawn(source, destination);
+    }).value();
 }
 
 MoveResult Board::move(King& piece, Coordinates const& source, 
                                     Coordinates const& destination) {
   ensurePieceIsAtSource(piece, source);
-  return move(source, destination,
-    [this] (Coordinates const& source, Coordinates const& destination) {
-      recordAndMove(source, destination);
-      ++m_countSincePawnMoveOrCapture;
-    });
+  return tryMove(source, destination,
+    [this](Coordinates const& source, Coordinates const& destination) {
+      moveNonPawn(source, destination);
+    }).value();
+}
+
+void Board::movePawn(Coordinates const& source, Coordinates const& destination) {
+  auto& srcIndex = indexAt(source);
+  auto& srcPiece = pieceAt(srcIndex);
+  if (isValidEnPassant(static_cast<Pawn const&>(srcPiece), source,
+                       destination)) {
+    auto toCaptureRow = (destination.row == 2) ? 3 : MAX_ROW_NUM - 3;
+    Coordinates toCapture(destination.column, toCaptureRow);
+    auto& toCaptureIndex = indexAt(toCapture);
+    removeFromBitboards(toCaptureIndex, toCapture);
+    moveInBitboards(srcIndex, source, destination);
+    m_movesHistory.emplace_back(*this, source, destination,
+                                srcPiece.getMovedStatus(),
+                                toCaptureIndex, toCapture);
+    toCaptureIndex = NO_PIECE;
+    srcPiece.setMovedStatus(true);
+    indexAt(destination) = srcIndex;
+    srcIndex = NO_PIECE;
+  } else {
+    recordAndMove(source, destination);
+  }
+
+  auto promotionRow = (currentPlayer() == Colour::White) ? MAX_ROW_NUM : 0;
+  if (destination.row == promotionRow) {
+    m_promotionSource = destination;
+  }
+  m_countSincePawnMoveOrCapture = 0;
+}
+
+void Board::moveNonPawn(Coordinates const& source,
+                        Coordinates const& destination) {
+  recordAndMove(source, destination);
+  ++m_countSincePawnMoveOrCapture;
 }
 
 template <typename Callable>
-MoveResult Board::move(Coordinates const& source,
-                       Coordinates const& destination, Callable&& mover) {
-  ensureGameNotOver();
-  ensureNoPromotionNeeded();
-  auto& piece = *(m_board[source.column][source.row]);
-  ensurePlayerCanMovePiece(piece);
-  auto gameState = MoveResult::GameState::NORMAL;
+MoveAttempt Board::tryMove(Coordinates const& source,
+                           Coordinates const& destination, Callable&& mover) {
+  auto const& piece = *at(source);
+  auto error = [&](InvalidMove::ErrorCode code) {
+    return MoveAttempt::Error{code, currentPlayer(),
+                              typeOf(indexAt(source)), source,
+                              destination, std::nullopt};
+  };
 
+  if (m_isGameOver) {
+    return error(InvalidMove::ErrorCode::GAME_OVER);
+  }
+  if (promotionPending()) {
+    return error(InvalidMove::ErrorCode::PENDING_PROMOTION);
+  }
+  if (piece.getColour() != currentPlayer()) {
+    return error(InvalidMove::ErrorCode::WRONG_TURN);
+  }
+
+  auto gameState = MoveResult::GameState::NORMAL;
   if (auto castlingType = tryCastling(source, destination)) {
     ++m_countSincePawnMoveOrCapture;
     gameState = checkGameState();
     togglePlayer();
-    return MoveResult(gameState, *castlingType);
+    return MoveResult(gameState, *castlingType,
+                      Move(source, destination, Move::Kind::Castling));
   }
 
-  if (!piece.isNormalMove(source, destination)) {
-    std::string sourceStr, targetStr;
-    try {
-      sourceStr = coordinatesToString(source);
-      targetStr = coordinatesToString(destination);
-    } catch (std::exception const& e) {
-      throw InvalidMove(e.what(), InvalidMove::ErrorCode::INVALID_COORDINATES);
-    }
-
-    std::stringstream ss;
-    ss << piece << " cannot move from " << sourceStr << " to " << targetStr;
-    throw InvalidMove(ss.str(), InvalidMove::ErrorCode::PIECE_LOGIC_ERROR);
+  if (!isNormalMove(source, destination)) {
+    return error(areWithinLimits(destination) ?
+                 InvalidMove::ErrorCode::PIECE_LOGIC_ERROR :
+                 InvalidMove::ErrorCode::INVALID_COORDINATES);
   }
 
-  // may need to restore count if move causes self check
-  auto tmpCount = m_countSincePawnMoveOrCapture;
-  mover(source, destination);
-
-  if (isInCheck(currentPlayer())) {
-    std::stringstream ss;
-    m_promotionSource.reset();
-    revertLastPieceMovement();
-    m_movesHistory.pop_back();
-    m_countSincePawnMoveOrCapture = tmpCount;
-    ss << (m_isWhiteTurn? "White" : "Black") <<
-            "'s move is invalid as they would be in check";
-    throw InvalidMove(ss.str(), InvalidMove::ErrorCode::CHECK_ERROR);
+  if (isSuicide(source, destination)) {
+    return error(InvalidMove::ErrorCode::CHECK_ERROR);
   }
 
+  auto movedPiece = typeOf(indexAt(source));
+  mover(source, destination);
   auto& lastMove = m_movesHistory.back();
   if (lastMove.destination != lastMove.removedPieceCoords) { // en passant
     m_hasher->removed(lastMove.removedPieceCoords);
   }
 
   m_hasher->pieceMoved(source, destination);
-  std::optional<std::string> capturedPieceName;
-  if (lastMove.removedPiece != nullptr) {
+  std::optional<PieceType> capturedPiece;
+  if (lastMove.removedPiece != NO_PIECE) {
     m_countSincePawnMoveOrCapture = 0;
-    capturedPieceName = lastMove.removedPiece->name();
+    capturedPiece = typeOf(lastMove.removedPiece);
   }
+  auto kind = lastMove.destination != lastMove.removedPieceCoords ?
+              Move::Kind::EnPassant : Move::Kind::Normal;
 
   if (promotionPending()) {
     gameState = MoveResult::GameState::AWAITING_PROMOTION;
   } else {
     m_hasher->togglePlayer();
-    auto hash = m_hasher->hash();
-    ++m_boardHashCount[hash];
+    recordPosition();
     gameState = checkGameState();
-    if (m_boardHashCount.at(hash) >= 3) {
+    if (repetitions() >= 3) {
       m_threeFoldRepetition = true;
     }
     togglePlayer();
   }
 
-  if (capturedPieceName) {
-    return MoveResult(gameState, *capturedPieceName);
-  }
-  return MoveResult(gameState);
-}
-
-void Board::ensureGameNotOver() {
-  if (m_isGameOver) {
-    throw InvalidMove("Game is already over, please reset",
-                       InvalidMove::ErrorCode::GAME_OVER);
-  }
-}
-
-void Board::ensurePlayerCanMovePiece(Piece const& piece) {
-  auto pieceColour = piece.getColour();
-  if ((pieceColour == Colour::Black && m_isWhiteTurn) ||
-    (pieceColour == Colour::White && !m_isWhiteTurn)) {
-    std::stringstream ss;
-    ss << "It is not " << (m_isWhiteTurn ? "Black" : "White");
-    ss << "'s turn to move";
-    throw InvalidMove(ss.str(), InvalidMove::ErrorCode::WRONG_TURN);
-  }
+  return MoveResult(gameState, movedPiece, Move(source, destination, kind),
+                    capturedPiece);
 }
 
 bool Board::promotionPending() const {
   return m_promotionSource.has_value();
 }
 
-void Board::ensureNoPromotionNeeded() {
-  if (promotionPending()) {
-    throw InvalidMove("Promote pawn before continuing",
-                      InvalidMove::ErrorCode::PENDING_PROMOTION);
-  }
-}
-
 MoveResult::GameState Board::checkGameState() {
   Colour enemyColour;
   enemyColour = m_isWhiteTurn ? Colour::Black : Colour::White;
@@ -537,8 +768,7 @@ MoveResult::GameState Board::checkGameState() {
   } else if (m_countSincePawnMoveOrCapture >= 150) { // 75 by each player
     m_isGameOver = true;
     return MoveResult::GameState::SEVENTYFIVE_MOVES_DRAW;
-  } else if (m_boardHashCount.count(m_hasher->hash()) &&
-                                      m_boardHashCount.at(m_hasher->hash()) >= 5) {
+  } else if (repetitions() >= 5) {
     m_isGameOver = true;
     return MoveResult::GameState::FIVEFOLD_REPETITION_DRAW;
   } else if (!sufficientMaterial()) {
@@ -550,6 +780,26 @@ MoveResult::GameState Board::checkGameState() {
   return MoveResult::GameState::NORMAL;
 }
 
+void Board::recordPosition() {
+  m_positionKeys.push_back(m_hasher->hash());
+  m_movesHistory.back().addedPositionKey = true;
+}
+
+size_t Board::repetitions() const {
+  // a position cannot repeat across a capture or a pawn move, and it only
+  // repeats with the same player to move, so every other key is compared
+  auto current = m_positionKeys.size() - 1;
+  auto reversiblePlies = std::min(
+                  static_cast<size_t>(m_countSincePawnMoveOrCapture), current);
+  size_t count = 1;
+  for (size_t distance = 2; distance <= reversiblePlies; distance += 2) {
+    if (m_positionKeys[current - distance] == m_positionKeys[current]) {
+      ++count;
+    }
+  }
+  return count;
+}
+
 void Board::togglePlayer() {
   m_isWhiteTurn = !m_isWhiteTurn;
 }
@@ -575,31 +825,45 @@ std::optional<CastlingType> getCastlingType(Coordinates const& source,
 }
 
 
-std::optional<CastlingType> Board::tryCastling(Coordinates const& source,
-                                                   Coordinates const& target) {
+/// Returns the source and target of the rook for the given castling.
+std::pair<Coordinates, Coordinates> getCastlingRookMove(CastlingType type,
+                                                        int row) {
+  if (type == CastlingType::KingSide) {
+    return {Coordinates(Board::MAX_COL_NUM, row),
+            Coordinates(Board::MAX_COL_NUM - 2, row)};
+  }
+  return {Coordinates(0, row), Coordinates(3, row)};
+}
+
+std::optional<CastlingType> Board::canCastle(Coordinates const& source,
+                                             Coordinates const& target) const {
+  auto king = at(source);
+  if (king == nullptr) {
+    return std::nullopt;
+  }
+  return king->getColour() == Colour::White ?
+         canCastle<Colour::White>(source, target) :
+         canCastle<Colour::Black>(source, target);
+}
+
+template <Colour colour>
+std::optional<CastlingType> Board::canCastle(Coordinates const& source,
+                                             Coordinates const& target) const {
   auto castlingTypeOpt = getCastlingType(source, target);
   if (!castlingTypeOpt) {
     return std::nullopt;
   }
   auto castlingType = castlingTypeOpt.value();
+  auto rookSource = getCastlingRookMove(castlingType, source.row).first;
+  int dir = (castlingType == CastlingType::KingSide) ? 1 : -1;
 
-  int dir = 0; // column directionality for castling
-  Coordinates rookTarget, rookSource;
-  if (castlingType == CastlingType::KingSide) {
-    rookSource = Coordinates(MAX_COL_NUM, source.row);
-    rookTarget = Coordinates(MAX_COL_NUM - 2, source.row);
-    dir = 1;
-  } else {
-    rookSource = Coordinates(0, source.row);
-    rookTarget = Coordinates(3, source.row);
-    dir = -1;
-  }
-
-  if (at(rookSource) == nullptr || at(source) == nullptr) {
+  // the corner may hold another piece, e.g. one promoted after capturing
+  if ((pieces(colour, PieceType::Rook) & squareMask(rookSource)) == 0) {
     return std::nullopt;
   }
 
-  if (!isFreeRow(source, target.column) || at(target) != nullptr) {
+  // every square between king and rook must be empty, not just the king's path
+  if (!isFreeRow(source, rookSource.column)) {
     return std::nullopt;
   }
 
@@ -607,113 +871,63 @@ std::optional<CastlingType> Board::tryCastling(Coordinates const& source,
     return std::nullopt;
   }
 
-  if (isInCheck(at(source)->getColour())) {
+  auto constexpr enemy = opponentOf(colour);
+  if (attackersTo<enemy>(toSquare(source), m_occupied) != 0) {
     return std::nullopt;
   }
 
-  // check if king's path is under attack
+  // check if king's path and destination are under attack
   for (auto coord = Coordinates(source.column + dir, source.row);
-                           coord.column != target.column;
+                           coord.column != target.column + dir;
                            coord.column += dir) {
-    if (isSuicide(source, coord)) {
+    if (attackersTo<enemy>(toSquare(coord), m_occupied) != 0) {
       return std::nullopt;
     }
   }
 
-  // simulate castling and abort if it ends up in a check
-  recordAndMove(rookSource, rookTarget);
-  recordAndMove(source, target);
-  if (isInCheck(at(target)->getColour())) {
-    revertLastPieceMovement();
-    m_movesHistory.pop_back();
-    revertLastPieceMovement();
-    m_movesHistory.pop_back();
+  return castlingType;
+}
+
+std::optional<CastlingType> Board::tryCastling(Coordinates const& source,
+                                                   Coordinates const& target) {
+  auto castlingType = canCastle(source, target);
+  if (!castlingType) {
     return std::nullopt;
   }
 
+  auto [rookSource, rookTarget] = getCastlingRookMove(*castlingType,
+                                                      source.row);
+  recordAndMove(rookSource, rookTarget);
+  recordAndMove(source, target);
+
   m_hasher->pieceMoved(rookSource, rookTarget);
   m_hasher->pieceMoved(source, target);
   m_hasher->togglePlayer();
-  ++m_boardHashCount[m_hasher->hash()];
+  recordPosition();
   return castlingType;
 }
 
 bool Board::sufficientMaterial() const {
-  std::vector<std::reference_wrapper<Piece>> whites;
-  std::vector<std::reference_wrapper<Piece>> blacks;
-  for (auto& column: m_board) {
-    for (auto& piecePtr: column) {
-      if (piecePtr == nullptr) {
-        continue;
-      }
-
-      if (piecePtr->getColour() == Colour::White) {
-        whites.emplace_back(*piecePtr);
-      } else {
-        blacks.emplace_back(*piecePtr);
-      }
-    }
-  }
-
-  if (whites.size() > 2 || blacks.size() > 2) {
-    return true;
-  }
-
-  for (auto const& white : whites) {
-    if (m_insufficientMaterial.count(white) == 0) {
-      return true;
-    }
-  }
-
-  for (auto const& black : blacks) {
-    if (m_insufficientMaterial.count(black) == 0) {
-      return true;
-    }
-  }
-
-  return false;
+  // a king with at most a knight or a bishop cannot checkmate
+  auto isDead = [](MaterialSignature material) {
+    return std::find(DEAD_MATERIAL.begin(), DEAD_MATERIAL.end(), material) !=
+           DEAD_MATERIAL.end();
+  };
+  return !isDead(m_material[0]) || !isDead(m_material[1]);
 }
 
 bool Board::isFreeColumn(Coordinates const& source, int limitRow) const {
   if (source.row == limitRow) {
     throw std::invalid_argument("source row and limitRow cannot be equal");
   }
-
-  // figure out directionality
-  int dir = (source.row > limitRow) ? -1: 1;
-  Coordinates src = source;
-  for (int row = src.row + dir; row != limitRow; row += dir) {
-    src.row = row;
-    if (!areWithinLimits(src)) {
-      throw std::invalid_argument("Coordinates go beyond the board limits");
-    }
-    if (at(src)) {
-      return false;
-    }
-  }
-
-  return true;
+  return isFreeBetween(source, Coordinates(source.column, limitRow));
 }
 
 bool Board::isFreeRow(Coordinates const& source, int limitCol) const {
   if (source.column == limitCol) {
     throw std::invalid_argument("source column and limitCol cannot be equal");
   }
-
-  // figure out directionality
-  int dir = (source.column > limitCol) ? -1 : 1;
-  Coordinates src = source;
-  for (int column = src.column+dir; column != limitCol; column += dir) {
-    src.column = column;
-    if (!areWithinLimits(src)) {
-      throw std::invalid_argument("Coordinates go beyond the board limits");
-    }
-    if (at(src)) {
-      return false;
-    }
-  }
-
-  return true;
+  return isFreeBetween(source, Coordinates(limitCol, source.row));
 }
 
 bool Board::isFreeDiagonal(Coordinates const& source,
@@ -725,115 +939,378 @@ bool Board::isFreeDiagonal(Coordinates const& source,
       throw std::invalid_argument("source and destination are"
                                  " not in the same diagonal");
   }
-  // figure out directionality
-  int rowAdd = (source.row > destination.row)? -1 : 1;
-  int columnAdd = (source.column > destination.column)? -1 : 1;
+  return isFreeBetween(source, destination);
+}
 
+bool Board::isFreeBetween(Coordinates const& source,
+                          Coordinates const& destination) const {
+  if (!areWithinLimits(source) || !areWithinLimits(destination)) {
+    throw std::invalid_argument("Coordinates go beyond the board limits");
+  }
   // this will not check the extremes, as intended
-  Coordinates src = source;
-  for (src = Coordinates(src.column + columnAdd, src.row + rowAdd);
-                                                    src != destination;
-                      src.row += rowAdd, src.column += columnAdd) {
-    if (!areWithinLimits(src)) {
-      throw std::invalid_argument("Coordinates go beyond the board limits");
-    }
-    if (at(src)) {
-      return false;
-    }
+  return (between(toSquare(source), toSquare(destination)) & m_occupied) == 0;
+}
+
+Piece const* Board::at(Coordinates const& coord) const {
+  if (!areWithinLimits(coord)) {
+    throw std::out_of_range("Coordinates are beyond the board limits");
+  }
+  if ((m_occupied & squareMask(coord)) == 0) {
+    return nullptr;
   }
+  return &pieceAt(m_board[coord.column][coord.row]);
+}
 
-  return true;
+void Board::addToBitboards(PieceIndex index, Coordinates const& coord) {
+  auto mask = squareMask(coord);
+  auto colour = pieceAt(index).getColour();
+  m_pieceBitboards[bitboardIndex(colour, typeOf(index))] |= mask;
+  m_colourBitboards[static_cast<size_t>(colour)] |= mask;
+  m_material[static_cast<size_t>(colour)] += materialOf(typeOf(index));
+  m_occupied |= mask;
 }
 
-Piece const* Board::at(Coordinates const& coord) const {
-  return m_board.at(coord.column).at(coord.row).get();
+void Board::removeFromBitboards(PieceIndex index, Coordinates const& coord) {
+  auto mask = ~squareMask(coord);
+  auto colour = pieceAt(index).getColour();
+  m_pieceBitboards[bitboardIndex(colour, typeOf(index))] &= mask;
+  m_colourBitboards[static_cast<size_t>(colour)] &= mask;
+  m_material[static_cast<size_t>(colour)] -= materialOf(typeOf(index));
+  m_occupied &= mask;
+}
+
+Bitboard Board::pieces(Colour colour, PieceType type) const {
+  return m_pieceBitboards[bitboardIndex(colour, type)];
+}
+
+Bitboard Board::pieces(Colour colour) const {
+  return m_colourBitboards[static_cast<size_t>(colour)];
+}
+
+void Board::moveInBitboards(PieceIndex index, Coordinates const& source,
+                            Coordinates const& destination) {
+  removeFromBitboards(index, source);
+  addToBitboards(index, destination);
 }
 
 std::optional<Coordinates> Board::getPieceCoordinates(Piece const& piece) const {
-  for (size_t i = 0; i < m_board.size(); ++i) {
-    for (size_t j = 0; j < m_board[i].size(); ++j) {
-      if (m_board[i][j].get() == &piece) {
-        return Coordinates(i, j);
-      }
+  auto squares = pieces(piece.getColour(), piece.type());
+  while (squares) {
+    auto coord = toCoordinates(popLowestSquare(squares));
+    if (&pieceAt(indexAt(coord)) == &piece) {
+      return coord;
     }
   }
 
   return std::nullopt;
 }
 
+int Board::kingSquare(Colour colour) const {
+  auto king = pieces(colour, PieceType::King);
+  if (king == 0) {
+    throw std::logic_error("Attempted to find non-existent king while looking "
+                           "for a check.");
+  }
+  return lowestSquare(king);
+}
+
+Bitboard Board::attackersTo(Coordinates const& target, Colour attacker) const {
+  if (!areWithinLimits(target)) {
+    throw std::out_of_range("Coordinates are beyond the board limits");
+  }
+  return attackersTo(toSquare(target), attacker, m_occupied);
+}
+
+Bitboard Board::attackersTo(int square, Colour attacker,
+                            Bitboard occupied) const {
+  return attacker == Colour::White ?
+         attackersTo<Colour::White>(square, occupied) :
+         attackersTo<Colour::Black>(square, occupied);
+}
+
+template <Colour attacker>
+Bitboard Board::attackersTo(int square, Bitboard occupied) const {
+  auto queens = pieces(attacker, PieceType::Queen);
+  // a piece attacks the square if, moving like it, the square reaches it
+  return (knightAttacks(square) & pieces(attacker, PieceType::Knight)) |
+         (kingAttacks(square) & pieces(attacker, PieceType::King)) |
+         (pawnAttacks<opponentOf(attacker)>(square) &
+                                    pieces(attacker, PieceType::Pawn)) |
+         (bishopAttacks(square, occupied) &
+                        (pieces(attacker, PieceType::Bishop) | queens)) |
+         (rookAttacks(square, occupied) &
+                        (pieces(attacker, PieceType::Rook) | queens));
+}
+
 bool Board::isInCheck(Colour kingColour) const {
-  if (auto kingCoord = getPieceCoordinates(m_kings.at(kingColour))) {
-    for (size_t i = 0; i < m_board.size(); ++i) {
-      for (size_t j = 0; j < m_board[i].size(); ++j) {
-        auto& piece = m_board[i][j]; 
-        // check if an enemy piece can move where the king is
-        if (piece != nullptr &&
-            piece->getColour() != kingColour &&
-            piece->isNormalMove(Coordinates(i,j), *kingCoord)) {
-          return true;
-        }
+  return attackersTo(kingSquare(kingColour), opponentOf(kingColour),
+                     m_occupied) != 0;
+}
+
+template <Colour colour>
+Board::KingSafety Board::kingSafety() const {
+  KingSafety safety;
+  safety.kingSquare = kingSquare(colour);
+  auto constexpr enemy = opponentOf(colour);
+  auto queens = pieces(enemy, PieceType::Queen);
+
+  // an enemy slider aiming at the king through exactly one of our pieces pins it
+  auto snipers =
+    (rookAttacks(safety.kingSquare, 0) &
+                                  (pieces(enemy, PieceType::Rook) | queens)) |
+    (bishopAttacks(safety.kingSquare, 0) &
+                                  (pieces(enemy, PieceType::Bishop) | queens));
+  while (snipers) {
+    auto blockers = between(safety.kingSquare, popLowestSquare(snipers)) &
+                                                                  m_occupied;
+    if (popCount(blockers) == 1 && (blockers & pieces(colour))) {
+      safety.pinned |= blockers;
+    }
+  }
+
+  // a single check is stopped by capturing or blocking, a double one is not
+  auto checkers = attackersTo<enemy>(safety.kingSquare, m_occupied);
+  if (popCount(checkers) == 1) {
+    safety.evasions = checkers | between(safety.kingSquare,
+                                         lowestSquare(checkers));
+  } else if (checkers != 0) {
+    safety.evasions = 0;
+  }
+  return safety;
+}
+
+bool Board::hasMovesLeft(Colour colour) const {
+  auto any = [](Coordinates const&, Coordinates const&) {
+    return true;
+  };
+  return colour == Colour::White ? findLegalMove<Colour::White>(any) :
+                                   findLegalMove<Colour::Black>(any);
+}
+
+void Board::generateLegalMoves(MoveList& moves) {
+  moves.clear();
+  if (m_isGameOver || promotionPending()) {
+    return;
+  }
+
+  auto promotionRow = (currentPlayer() == Colour::White) ? MAX_ROW_NUM : 0;
+  auto add = [&](Coordinates const& source, Coordinates const& destination) {
+    auto type = typeOf(indexAt(source));
+    if (type == PieceType::Pawn && destination.row == promotionRow) {
+      for (auto option : {PromotionOption::Queen, PromotionOption::Rook,
+                          PromotionOption::Bishop, PromotionOption::Knight}) {
+        moves.emplace_back(source, destination, option);
       }
+    } else if (type == PieceType::Pawn && source.column != destination.column
+               && at(destination) == nullptr) {
+      moves.emplace_back(source, destination, Move::Kind::EnPassant);
+    } else if (type == PieceType::King &&
+               abs(destination.column - source.column) == CASTLE_DISTANCE) {
+      moves.emplace_back(source, destination, Move::Kind::Castling);
+    } else {
+      moves.emplace_back(source, destination);
     }
     return false;
+  };
+  if (currentPlayer() == Colour::White) {
+    findLegalMove<Colour::White>(add);
+  } else {
+    findLegalMove<Colour::Black>(add);
   }
-
-  throw std::logic_error("Attempted to find non-existent king while looking "
-                         "for a check.");
 }
 
-bool Board::hasMovesLeft(Colour colour) {
-  for (size_t i = 0; i < m_board.size(); ++i) {
-    for (size_t j = 0; j < m_board[i].size(); ++j) {
-      if (m_board[i][j] == nullptr || m_board[i][j]->getColour() != colour) {
-        continue;
+template <Colour colour, typename Predicate>
+bool Board::findLegalMove(Predicate&& isWanted) const {
+  Destinations destinations;
+  auto safety = kingSafety<colour>();
+  auto owned = pieces(colour);
+  while (owned) {
+    auto source = toCoordinates(popLowestSquare(owned));
+    auto type = typeOf(indexAt(source));
+    auto count = candidateDestinations<colour>(source, destinations);
+    for (size_t k = 0; k < count; ++k) {
+      auto const& destination = destinations[k];
+      bool isLegal = false;
+      if (type == PieceType::King &&
+          abs(destination.column - source.column) == CASTLE_DISTANCE) {
+        isLegal = canCastle<colour>(source, destination).has_value();
+      } else {
+        isLegal = isNormalMove<colour>(source, destination) &&
+                  !isSuicide<colour>(source, destination, safety);
       }
-      auto srcCoord = Coordinates(i, j);
-      if (pieceHasMovesLeft(srcCoord)) {
+
+      if (isLegal && isWanted(source, destination)) {
         return true;
       }
     }
   }
-
-  // tried all possible moves and check is unavoidable
   return false;
 }
 
-bool Board::pieceHasMovesLeft(Coordinates const& srcCoord) {
-  for (size_t i = 0; i < m_board.size(); ++i) {
-    for (size_t j = 0; j < m_board[i].size(); ++j) {
-      Coordinates targetCoord(i, j);
-      if (at(srcCoord)->isNormalMove(srcCoord, targetCoord) &&
-                                       !isSuicide(srcCoord, targetCoord)) {
-        return true;
-      }
+template <Colour colour>
+size_t Board::candidateDestinations(Coordinates const& source,
+                                    Destinations& destinations) const {
+  size_t count = 0;
+  auto addIfWithinLimits = [&](int column, int row) {
+    auto coord = Coordinates(column, row);
+    if (areWithinLimits(coord)) {
+      destinations[count++] = coord;
+    }
+  };
+  auto addAll = [&](Bitboard squares) {
+    while (squares) {
+      destinations[count++] = toCoordinates(popLowestSquare(squares));
+    }
+  };
+
+  auto type = typeOf(indexAt(source));
+  auto ownPieces = pieces(colour);
+  switch (type) {
+  case PieceType::Pawn: {
+    int constexpr dir = (colour == Colour::White) ? 1 : -1;
+    addIfWithinLimits(source.column, source.row + dir);
+    addIfWithinLimits(source.column, source.row + 2 * dir);
+    addAll(pawnAttacks<colour>(toSquare(source)) & ~ownPieces);
+    break;
+  }
+  case PieceType::Knight:
+    addAll(knightAttacks(toSquare(source)) & ~ownPieces);
+    break;
+  case PieceType::King:
+    addAll(kingAttacks(toSquare(source)) & ~ownPieces);
+    addIfWithinLimits(source.column + CASTLE_DISTANCE, source.row);
+    addIfWithinLimits(source.column - CASTLE_DISTANCE, source.row);
+    break;
+  case PieceType::Bishop:
+  case PieceType::Rook:
+  case PieceType::Queen: {
+    auto square = toSquare(source);
+    Bitboard attacks = 0;
+    if (type != PieceType::Rook) {
+      attacks |= bishopAttacks(square, m_occupied);
     }
+    if (type != PieceType::Bishop) {
+      attacks |= rookAttacks(square, m_occupied);
+    }
+    addAll(attacks & ~ownPieces);
+    break;
   }
-  return false;
+  }
+  return count;
 }
 
 void Board::recordAndMove(Coordinates const& source,
                                Coordinates const& destination) {
-  auto& pieceDest = m_board[destination.column][destination.row];
-  auto& pieceSrc = m_board[source.column][source.row];
-  if (pieceDest != nullptr) {
-     m_movesHistory.emplace_back(*this, source, destination,
-                          pieceSrc->getMovedStatus(),
-                          std::move(pieceDest));
-  } else {
-     m_movesHistory.emplace_back(*this, source, destination,
-                          pieceSrc->getMovedStatus());
-   }
-   pieceSrc->setMovedStatus(true);
-   pieceDest = std::move(pieceSrc);
+  auto& destIndex = indexAt(destination);
+  auto& srcIndex = indexAt(source);
+  auto& pieceSrc = pieceAt(srcIndex);
+  if (destIndex != NO_PIECE) {
+     removeFromBitboards(destIndex, destination);
+  }
+  m_movesHistory.emplace_back(*this, source, destination,
+                              pieceSrc.getMovedStatus(), destIndex);
+  moveInBitboards(srcIndex, source, destination);
+  pieceSrc.setMovedStatus(true);
+  destIndex = srcIndex;
+  srcIndex = NO_PIECE;
+}
+
+bool Board::isNormalMove(Coordinates const& source,
+                         Coordinates const& destination) const {
+  // the checks of Piece::isNormalMove, dispatched on the type of the piece
+  if (!areWithinLimits(source) || !areWithinLimits(destination) ||
+      source == destination || (m_occupied & squareMask(source)) == 0) {
+    return false;
+  }
+  return pieceAt(indexAt(source)).getColour() == Colour::White ?
+         isNormalMove<Colour::White>(source, destination) :
+         isNormalMove<Colour::Black>(source, destination);
+}
+
+template <Colour colour>
+bool Board::isNormalMove(Coordinates const& source,
+                         Coordinates const& destination) const {
+  // the piece at the source is known to belong to the given colour
+  auto target = squareMask(destination);
+  if (pieces(colour) & target) {
+    return false;
+  }
+
+  auto square = toSquare(source);
+  switch (typeOf(indexAt(source))) {
+  case PieceType::Pawn:
+    return isNormalPawnMove<colour>(source, destination);
+  case PieceType::Knight:
+    return (knightAttacks(square) & target) != 0;
+  case PieceType::Bishop:
+    return (bishopAttacks(square, m_occupied) & target) != 0;
+  case PieceType::Rook:
+    return (rookAttacks(square, m_occupied) & target) != 0;
+  case PieceType::Queen:
+    return (queenAttacks(square, m_occupied) & target) != 0;
+  case PieceType::King:
+    return (kingAttacks(square) & target) != 0;
+  }
+  return false;
+}
+
+template <Colour colour>
+bool Board::isNormalPawnMove(Coordinates const& source,
+                             Coordinates const& destination) const {
+  auto square = toSquare(source);
+  auto target = squareMask(destination);
+  if (pawnAttacks<colour>(square) & target) {
+    return (m_occupied & target) != 0 ||
+           isValidEnPassant<colour>(source, destination);
+  }
+
+  if (source.column != destination.column || (m_occupied & target) != 0) {
+    return false;
+  }
+  auto forwardSteps = (toSquare(destination) - square) / FORWARD<colour>;
+  if (forwardSteps == 1) {
+    return true;
+  }
+  return forwardSteps == 2 && !pieceAt(indexAt(source)).getMovedStatus() &&
+         (between(square, toSquare(destination)) & m_occupied) == 0;
 }
 
 bool Board::isSuicide(Coordinates const& source,
-                          Coordinates const& destination) {
-  recordAndMove(source, destination);
-  bool check = isInCheck(at(destination)->getColour());
-  revertLastPieceMovement();
-  m_movesHistory.pop_back();
-  return check;
+                      Coordinates const& destination) const {
+  return pieceAt(indexAt(source)).getColour() == Colour::White ?
+    isSuicide<Colour::White>(source, destination, kingSafety<Colour::White>()) :
+    isSuicide<Colour::Black>(source, destination, kingSafety<Colour::Black>());
+}
+
+template <Colour colour>
+bool Board::isSuicide(Coordinates const& source,
+                      Coordinates const& destination,
+                      KingSafety const& safety) const {
+  auto index = indexAt(source);
+  auto constexpr enemy = opponentOf(colour);
+  auto sourceMask = squareMask(source);
+  auto destinationMask = squareMask(destination);
+
+  // the king must not step onto a square attacked once it has left its own
+  if (typeOf(index) == PieceType::King) {
+    return attackersTo<enemy>(toSquare(destination),
+                              m_occupied & ~sourceMask) != 0;
+  }
+
+  // en passant empties two squares of the same row, so the pins cannot tell
+  if (typeOf(index) == PieceType::Pawn && at(destination) == nullptr &&
+      source.column != destination.column) {
+    auto capturedMask = squareMask(Coordinates(destination.column, source.row));
+    auto occupied = (m_occupied & ~sourceMask & ~capturedMask) | destinationMask;
+    return (attackersTo<enemy>(safety.kingSquare, occupied) &
+                                                      ~capturedMask) != 0;
+  }
+
+  if ((safety.evasions & destinationMask) == 0) {
+    return true;
+  }
+  return (safety.pinned & sourceMask) &&
+         (line(safety.kingSquare, toSquare(source)) & destinationMask) == 0;
 }
 
 void Board::undoLastMove() {
@@ -849,19 +1326,23 @@ void Board::undoLastMove() {
       m_movesHistory.pop_back();
       m_hasher->restorePreviousHash();
     }
+    auto& lastMove = m_movesHistory.back();
+    // the hasher is told of the pawn captured en passant as a separate change
+    auto enPassant = lastMove.removedPiece != NO_PIECE &&
+                     lastMove.removedPieceCoords != lastMove.destination;
     revertLastPieceMovement();
 
-    auto& lastMove = m_movesHistory.back();
     m_isGameOver = false;
     m_isWhiteTurn = lastMove.isWhiteTurn;
     m_promotionSource = lastMove.promotionSource;
-    m_boardHashCount = lastMove.boardHashCount;
     m_countSincePawnMoveOrCapture = lastMove.countSincePawnMoveOrCapture;
     m_threeFoldRepetition = lastMove.threeFoldRepetition;
-    m_insufficientMaterial = lastMove.insufficientMaterial;
 
     m_movesHistory.pop_back();
     m_hasher->restorePreviousHash();
+    if (enPassant) {
+      m_hasher->restorePreviousHash();
+    }
   }
 }
 
@@ -870,54 +1351,65 @@ void Board::revertLastPieceMovement() {
   auto& source = lastMove.source;
   auto& dest = lastMove.destination;
 
-  m_board[source.column][source.row] = std::move(m_board[dest.column][dest.row]);
-  m_board[source.column][source.row] ->setMovedStatus(lastMove.sourceMovedStatus);
+  if (lastMove.addedPositionKey) {
+    m_positionKeys.pop_back();
+  }
 
-  if (lastMove.removedPiece != nullptr) {
+  auto index = indexAt(dest);
+  auto& piece = pieceAt(index);
+  moveInBitboards(index, dest, source);
+  piece.setMovedStatus(lastMove.sourceMovedStatus);
+  indexAt(dest) = NO_PIECE;
+  indexAt(source) = index;
+
+  if (lastMove.removedPiece != NO_PIECE) {
     Coordinates target = dest;
     if (lastMove.removedPieceCoords != lastMove.destination) { // en passant
       target = lastMove.removedPieceCoords;
     }
-    m_board[target.column][target.row] = std::move(lastMove.removedPiece);
+    auto& targetIndex = indexAt(target);
+    if (targetIndex != NO_PIECE) { // a promotion piece is replaced by the pawn
+      removeFromBitboards(targetIndex, target);
+      // moves are undone in order, so the promotion piece was the last added
+      m_pieces[--m_piecesCount] = std::monostate();
+    }
+    addToBitboards(lastMove.removedPiece, target);
+    targetIndex = lastMove.removedPiece;
   }
 
 }
 
 bool Board::isValidEnPassant(Pawn const& pawn, Coordinates const& source,
                                          Coordinates const& destination) const {
-  if (&pawn != at(source) || m_movesHistory.empty()) {
-    return false;
-  }
-  auto& lastMove = m_movesHistory.back();
-  auto lastMoveColour = lastMove.isWhiteTurn ?
-                        Colour::White : Colour::Black;
-  if (lastMove.sourceMovedStatus || pawn.getColour() == lastMoveColour) {
+  if (&pawn != at(source)) {
     return false;
   }
+  return pawn.getColour() == Colour::White ?
+         isValidEnPassant<Colour::White>(source, destination) :
+         isValidEnPassant<Colour::Black>(source, destination);
+}
 
-  auto& lastMoveDest = lastMove.destination;
-  if (source.row != lastMoveDest.row ||
-      abs(source.column - lastMoveDest.column) != 1) {
+template <Colour colour>
+bool Board::isValidEnPassant(Coordinates const& source,
+                             Coordinates const& destination) const {
+  if (m_movesHistory.empty()) {
     return false;
   }
-
-  auto& lastMoveSrc = lastMove.source;
-  if (destination.column != lastMoveSrc.column) {
+  auto& lastMove = m_movesHistory.back();
+  if (lastMove.sourceMovedStatus ||
+      lastMove.isWhiteTurn == (colour == Colour::White)) {
     return false;
   }
 
-  if (lastMoveSrc.row == 1 && lastMoveDest.row == 3 &&
-      destination.row == 2) {
-      return true;
-  }
-
-  if (lastMoveSrc.row == MAX_ROW_NUM - 1 &&
-      lastMoveDest.row == MAX_ROW_NUM - 3 &&
-      destination.row == MAX_ROW_NUM - 2) {
-      return true;
-  }
-
-  return false;
+  // the enemy pawn must have just stepped twice to the side of this one
+  auto& lastMoveDest = lastMove.destination;
+  auto& lastMoveSrc = lastMove.source;
+  return source.row == lastMoveDest.row &&
+         abs(source.column - lastMoveDest.column) == 1 &&
+         destination.column == lastMoveSrc.column &&
+         lastMoveSrc.row == relativeRow<colour>(MAX_ROW_NUM - 1) &&
+         lastMoveDest.row == relativeRow<colour>(MAX_ROW_NUM - 3) &&
+         destination.row == relativeRow<colour>(MAX_ROW_NUM - 2);
 }
 
 std::optional<MoveResult> Board::promote(PromotionOption piece) {
@@ -925,40 +1417,97 @@ std::optional<MoveResult> Board::promote(PromotionOption piece) {
     return std::nullopt;
   }
 
-  auto& source = *m_promotionSource;
-  auto& piecePtr = m_board[source.column][source.row];
-  auto moved = piecePtr->getMovedStatus();
-  m_movesHistory.emplace_back(*this, source, source,
-                            moved, std::move(piecePtr));
-  piecePtr = std::move(buildPromotionPiece(piece));
-  if (piece == PromotionOption::Knight || piece == PromotionOption::Bishop) {
-    m_insufficientMaterial.emplace(*piecePtr);
+  auto source = *m_promotionSource;
+  auto const& pawnMove = m_movesHistory.back();
+  auto pawnSource = pawnMove.source;
+  std::optional<PieceType> capturedPiece;
+  if (pawnMove.removedPiece != NO_PIECE) {
+    capturedPiece = typeOf(pawnMove.removedPiece);
   }
 
+  auto& index = indexAt(source);
+  removeFromBitboards(index, source);
+  m_movesHistory.emplace_back(*this, source, source,
+                              pieceAt(index).getMovedStatus(), index);
+  index = addPromotionPiece(piece);
+  addToBitboards(index, source);
+
   m_promotionSource.reset();
-  auto state = checkGameState();
   m_hasher->replacedWithPromotion(source, piece, currentPlayer());
-  togglePlayer();
   m_hasher->togglePlayer();
-  return MoveResult(state);
+  recordPosition();
+  auto state = checkGameState();
+  togglePlayer();
+  return MoveResult(state, PieceType::Pawn, Move(pawnSource, source, piece),
+                    capturedPiece);
+}
+
+template <typename Chessman>
+Board::PieceIndex Board::addPiece(Colour colour) {
+  if (m_piecesCount == MAX_PIECES) {
+    throw std::logic_error("No room is left to add a piece");
+  }
+  m_pieces[m_piecesCount].emplace<Chessman>(colour);
+  return static_cast<PieceIndex>(m_piecesCount++);
 }
 
-std::unique_ptr<PromotionPiece> Board::buildPromotionPiece(
-                                                        PromotionOption piece) {
+Board::PieceIndex Board::addPromotionPiece(PromotionOption piece) {
   switch (piece) {
   case PromotionOption::Queen:
-    return std::make_unique<Queen>(currentPlayer(), *this);
+    return addPiece<Queen>(currentPlayer());
   case PromotionOption::Knight:
-    return std::make_unique<Knight>(currentPlayer(), *this);
+    return addPiece<Knight>(currentPlayer());
   case PromotionOption::Bishop:
-    return std::make_unique<Bishop>(currentPlayer(), *this);
+    return addPiece<Bishop>(currentPlayer());
   case PromotionOption::Rook:
-    return std::make_unique<Rook>(currentPlayer(), *this);
+    return addPiece<Rook>(currentPlayer());
   default:
     throw std::logic_error("Promotion not correctly implemented");
   }
 }
 
+PieceType Board::typeOf(PieceIndex index) const {
+  using Storage = decltype(m_pieces)::value_type;
+  static_assert(std::is_same_v<std::variant_alternative_t<
+                  static_cast<size_t>(PieceType::Pawn) + 1, Storage>, Pawn> &&
+                std::is_same_v<std::variant_alternative_t<
+                  static_cast<size_t>(PieceType::King) + 1, Storage>, King>,
+                "Pieces must be stored in the order of their types");
+  // the empty alternative comes first, so the others are off by one
+  return static_cast<PieceType>(m_pieces[index].index() - 1);
+}
+
+Piece& Board::pieceAt(PieceIndex index) {
+  return const_cast<Piece&>(std::as_const(*this).pieceAt(index));
+}
+
+Piece const& Board::pieceAt(PieceIndex index) const {
+  return std::visit([](auto const& piece) -> Piece const& {
+    if constexpr (std::is_same_v<std::decay_t<decltype(piece)>,
+                                 std::monostate>) {
+      throw std::logic_error("Attempted to access a removed piece");
+    } else {
+      return piece;
+    }
+  }, m_pieces[index]);
+}
+
+Board::PieceIndex& Board::indexAt(Coordinates const& coord) {
+  return m_board[coord.column][coord.row];
+}
+
+Board::PieceIndex Board::indexAt(Coordinates const& coord) const {
+  return m_board[coord.column][coord.row];
+}
+
+Board::Squares Board::emptySquares() {
+  Squares squares;
+  for (auto& column : squares) {
+    column.fill(NO_PIECE);
+  }
+  return squares;
+}
+
 void printBottomLines(std::ostream& out) {
   out << "\n|";
   for (int j = 0; j <= Board::MAX_COL_NUM; ++j) {
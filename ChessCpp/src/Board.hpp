@@ -3,24 +3,32 @@
 
 #include "AbstractBoard.hpp"
 #include <array>
+#include "Bishop.hpp"
+#include "Bitboard.hpp"
 #include "BoardHasher.hpp"
+#include <cstdint>
 #include "Exceptions.hpp"
+#include "King.hpp"
+#include "Knight.hpp"
 #include <memory>
+#include "Move.hpp"
+#include "MoveAttempt.hpp"
 #include "MoveResult.hpp"
 #include <optional>
 #include <ostream>
+#include "Pawn.hpp"
 #include "Piece.hpp"
+#include "Position.hpp"
+#include "Queen.hpp"
+#include "Rook.hpp"
 #include <string>
 #include <string_view>
-#include <unordered_map>
-#include <unordered_set>
 #include "Utils.hpp"
+#include <variant>
 #include <vector>
 
 namespace Chess {
 
-class King; class Pawn; 
-
 /**
   Represents a chessboard. It is responsible for executing moves while
   containing the state of the game.
@@ -32,17 +40,27 @@ public:
     Throws if the format is incorrect, or the coordinates are out of bounds.
   */
   static Coordinates stringToCoordinates(std::string_view coord);
+  /**
+    Returns why the string coordinates are rejected by stringToCoordinates,
+    without throwing, or an empty optional if they are valid.
+  */
+  static std::optional<std::string> invalidCoordinatesReason(
+                                                    std::string_view coord);
   /// Converts numeric coordinates into string coordinates (eg 0,1 to "A2").
   static std::string coordinatesToString(Coordinates const& coord);
 
   /**
     Places all pieces in their standard starting positions.
     Defaults to Zobrist hashing for the 3-fold and 5-fold repetition rules.
+    The pieces and the hash are copied from a starting state computed once,
+    but the hasher, being replaceable, and the first key of the repetition
+    history are still allocated on the heap.
   */
   Board();
 
   /**
-    Places all pieces in their standard starting positions.
+    Places all pieces in their standard starting positions, copied from a
+    state computed once.
     Uses the hasher provided for the 3-fold and 5-fold repetition rules.
   */
   Board(std::unique_ptr<BoardHasher> hasher);
@@ -77,20 +95,53 @@ public:
         Coordinates const& blackKing);
 
   /**
-    Performs move construction with a cost of O(N), where N is the total
-    number of pieces that are and were on the board during this game.
+    Places the pieces as in the position given, with the same player to move,
+    pieces which moved, right to capture en passant and count of plies since
+    the last pawn move or capture. The board defaults to Zobrist hashing.
+
+    Since en passant relies on the last move, a position allowing it is built
+    by playing the double step from the position before it. Undoing the last
+    move therefore takes the pawn back.
+
+    Throws std::invalid_argument in case of:
+    1) multiple pieces sharing the same coordinates;
+    2) a number of kings per colour other than one;
+    3) pawns in the first or last row;
+    4) a right to capture en passant which no legal double step, replayable
+       on the position before it, could have granted;
+    5) pawns marked as unmoved outside their starting row, or as moved in it,
+       since a position only grants double steps from the starting row.
+  */
+  explicit Board(Position const& position);
+
+  /**
+    Performs move construction in constant time, regardless of the number of
+    pieces that are and were on the board during this game.
   */
   Board(Board&& other) noexcept;
 
   /**
-    Performs move assignment with a cost of O(N), where N is the total number
-    of pieces that are and were on the board during this game.
+    Performs move assignment in constant time, regardless of the number of
+    pieces that are and were on the board during this game.
   */
   Board& operator=(Board&& other) noexcept;
 
-  /// Resets the chessboard to its standard, initial configuration.
+  /**
+    Resets the chessboard to its standard, initial configuration. The pieces
+    and the hash are copied from a starting state computed only once.
+  */
   void reset();
 
+  /**
+    Resets the chessboard to the position given, as constructing a board from
+    it would, but reusing the memory the board already holds. The key of the
+    position is taken as the hash, so a position obtained earlier from
+    position() can start any number of games cheaply.
+    Throws as the constructor does. A position failing the checks listed there
+    leaves the board unchanged.
+  */
+  void reset(Position const& position);
+
   /**
     Performs a move from a source to a destination and alternates between
     players according to the rules of chess. Coordinates are given column first
@@ -111,16 +162,43 @@ public:
   */
   MoveResult move(Coordinates const& src, Coordinates const& dest);
 
+  /**
+    Performs the move given, including the promotion it carries if any, and
+    alternates between players according to the rules of chess. The kind of
+    the move is not trusted, but established from the position.
+
+    Returns an object containing information regarding the move executed.
+    In case of invalid move, or of a promotion given for a move which does
+    not need one, an InvalidMove exception is thrown.
+  */
+  MoveResult move(Move const& move);
+
+  /**
+    Performs a move as described in move(std::string_view,std::string_view),
+    but reports an invalid move through the result instead of throwing.
+    Rejecting a move neither throws nor allocates memory.
+  */
+  MoveAttempt tryMove(std::string_view src, std::string_view destination);
+
+  /**
+    Performs a move as described in move(Coordinates const&,Coordinates const&),
+    but reports an invalid move through the result instead of throwing.
+    Rejecting a move neither throws nor allocates memory.
+  */
+  MoveAttempt tryMove(Coordinates const& src, Coordinates const& dest);
+
   /**
     Retrieves the piece corresponding to the coordinates given.
     Returns a nullptr if no piece is found at those coordinates.
-    The pointer returned is non-owning.
+    The pointer returned is non-owning, and remains valid until the board is
+    moved, reset or destroyed.
   */
   Piece const* at(Coordinates const& coord) const override;
 
   /**
     Retrieves the coordinates corresponding to the piece given.
     Returns an empty optional if the piece is not on this board.
+    Only the squares of pieces sharing its colour and type are checked.
   */
   std::optional<Coordinates> getPieceCoordinates(Piece const& piece) const;
 
@@ -131,22 +209,51 @@ public:
   /**
     Checks if there are no pieces from the source to the destination.
     The check is not inclusive of the start and end columns.
+    Throws if the coordinates go beyond the board limits.
   */
   bool isFreeColumn(Coordinates const& source, int limitRow) const override;
 
   /**
     Checks if there are no pieces from the source to the destination.
     The check is not inclusive of the start and end rows.
+    Throws if the coordinates go beyond the board limits.
   */
   bool isFreeRow(Coordinates const& source, int limitCol) const override;
 
   /**
     Checks if there are no pieces from the source to the destination.
     The check is not inclusive of the start and end positions.
+    Throws if the coordinates go beyond the board limits.
   */
   bool isFreeDiagonal(Coordinates const& source,
                       Coordinates const& destination) const override;
 
+  /**
+    Returns the pieces of the given colour attacking the square at the given
+    coordinates, one bit per square as described in Bitboard.
+    Throws if the coordinates go beyond the board limits.
+  */
+  Bitboard attackersTo(Coordinates const& target, Colour attacker) const;
+
+  /**
+    Returns the squares holding the pieces of the given colour and type, one
+    bit per square as described in Bitboard. The squares are kept up to date
+    as moves are made and undone, so this takes constant time.
+  */
+  Bitboard pieces(Colour colour, PieceType type) const;
+
+  /// Returns the squares holding the pieces of the given colour.
+  Bitboard pieces(Colour colour) const;
+
+  /**
+    Fills the list given with every legal move of the current player, replacing
+    its previous content. Castling is listed as the move of the king, whereas
+    a pawn reaching the last row is listed once per promotion option. Each move
+    is marked with its kind (e.g. en passant).
+    The list is left empty if the game is over or a promotion is pending.
+  */
+  void generateLegalMoves(MoveList& moves);
+
   /// Returns true if a player needs to promote a piece, false otherwise.
   bool promotionPending() const;
 
@@ -163,6 +270,17 @@ public:
   /// Returns true if the game reached its conclusion, false otherwise.
   bool isGameOver() const;
 
+  /// Returns the hash of the current position, as computed by the hasher.
+  BoardHash hash() const;
+
+  /**
+    Returns the state of the game relevant to the rules, which can be copied
+    cheaply and have moves applied to it. Its key is the one of a Zobrist
+    hasher, whichever hasher the board uses.
+    Throws std::logic_error if a promotion is pending.
+  */
+  Position position() const;
+
   /// Prints the board to the output stream provided.
   friend std::ostream& operator<<(std::ostream& out, Board const& board);
 
@@ -182,11 +300,21 @@ public:
   virtual ~Board();
 
 private:
-  void initializePiecesInStandardPos();
+  using PieceIndex = std::uint8_t;
+
+  void copyStandardPieces();
+  static void ensureIsValid(Position const& position);
+  void initializePieces(Position const& position);
+  template <typename Chessman>
+  void placePieces(Bitboard squares, Colour colour, Bitboard unmoved);
+  void clearGame();
 
+  static std::optional<Coordinates> parseCoordinates(std::string_view coord);
   template <typename Callable>
-  MoveResult move(Coordinates const& source, Coordinates const& destination,
-                                                        Callable&& mover);
+  MoveAttempt tryMove(Coordinates const& source,
+                      Coordinates const& destination, Callable&& mover);
+  void movePawn(Coordinates const& source, Coordinates const& destination);
+  void moveNonPawn(Coordinates const& source, Coordinates const& destination);
   MoveResult move(Pawn& piece, Coordinates const& source,
                                 Coordinates const& destination) override;
   MoveResult move(PromotionPiece& piece, Coordinates const& source,
@@ -197,18 +325,62 @@ private:
   void revertLastPieceMovement();
   std::optional<CastlingType> tryCastling(Coordinates const& source,
                                           Coordinates const& target);
-  bool hasMovesLeft(Colour colour);
-  bool pieceHasMovesLeft(Coordinates const& srcCoord);
+  std::optional<CastlingType> canCastle(Coordinates const& source,
+                                        Coordinates const& target) const;
+  template <Colour colour>
+  std::optional<CastlingType> canCastle(Coordinates const& source,
+                                        Coordinates const& target) const;
+  bool hasMovesLeft(Colour colour) const;
+  template <Colour colour, typename Predicate>
+  bool findLegalMove(Predicate&& isWanted) const;
+  using Destinations = std::array<Coordinates, 2 * (MAX_ROW_NUM + MAX_COL_NUM)>;
+  template <Colour colour>
+  size_t candidateDestinations(Coordinates const& source,
+                               Destinations& destinations) const;
+  int kingSquare(Colour colour) const;
+  Bitboard attackersTo(int square, Colour attacker, Bitboard occupied) const;
+  template <Colour attacker>
+  Bitboard attackersTo(int square, Bitboard occupied) const;
   bool isInCheck(Colour kingColour) const;
-  bool isSuicide(Coordinates const& sourceCoord, Coordinates const& targetCoord);
+  struct KingSafety;
+  template <Colour colour>
+  KingSafety kingSafety() const;
+  bool isSuicide(Coordinates const& source,
+                 Coordinates const& destination) const;
+  template <Colour colour>
+  bool isSuicide(Coordinates const& source, Coordinates const& destination,
+                 KingSafety const& safety) const;
+  bool isNormalMove(Coordinates const& source,
+                    Coordinates const& destination) const;
+  template <Colour colour>
+  bool isNormalMove(Coordinates const& source,
+                    Coordinates const& destination) const;
+  template <Colour colour>
+  bool isNormalPawnMove(Coordinates const& source,
+                        Coordinates const& destination) const;
+  template <Colour colour>
+  bool isValidEnPassant(Coordinates const& source,
+                        Coordinates const& destination) const;
   void recordAndMove(Coordinates const& source,
                       Coordinates const& destination);
-  void ensureGameNotOver();
-  void ensurePlayerCanMovePiece(Piece const& piece);
+  void addToBitboards(PieceIndex index, Coordinates const& coord);
+  void removeFromBitboards(PieceIndex index, Coordinates const& coord);
+  void moveInBitboards(PieceIndex index, Coordinates const& source,
+                       Coordinates const& destination);
+  bool isFreeBetween(Coordinates const& source,
+                     Coordinates const& destination) const;
   MoveResult::GameState checkGameState();
-  void ensureNoPromotionNeeded();
+  void recordPosition();
+  size_t repetitions() const;
   void togglePlayer();
-  std::unique_ptr<PromotionPiece> buildPromotionPiece(PromotionOption piece);
+  template <typename Chessman>
+  PieceIndex addPiece(Colour colour);
+  PieceIndex addPromotionPiece(PromotionOption piece);
+  Piece& pieceAt(PieceIndex index);
+  Piece const& pieceAt(PieceIndex index) const;
+  PieceType typeOf(PieceIndex index) const;
+  PieceIndex& indexAt(Coordinates const& coord);
+  PieceIndex indexAt(Coordinates const& coord) const;
   bool sufficientMaterial() const;
   void ensurePieceIsAtSource(Piece const& piece,
                               Coordinates const& source) const;
@@ -218,12 +390,6 @@ private:
                         Colour colour,
                         Predicate&& isStandardStartingPos);
 
-  template <typename Chessman, typename Predicate, typename Callable>
-  void initializePieces(std::vector<Coordinates> const& coords,
-                        Colour colour,
-                        Predicate&& isStandardStartingPos,
-                        Callable&& finalActions);
-
   void initializePawns(std::vector<Coordinates> const& coords,
                         Colour colour);
   void initializeRooks(std::vector<Coordinates> const& coords,
@@ -239,15 +405,33 @@ private:
   bool m_isGameOver = false;
   bool m_isWhiteTurn = true;
   std::optional<Coordinates> m_promotionSource;
-  std::array<std::array<std::unique_ptr<Piece>, MAX_ROW_NUM+1>,
-                                                MAX_COL_NUM+1> m_board;
-  std::unordered_map<Colour, King&> m_kings;
+  // every piece that is or was on the board is stored in place, in order of
+  // creation; a pawn can be promoted once, hence the room for extra pieces
+  static size_t constexpr MAX_PIECES = AREA +
+                                       (MAX_ROW_NUM - 1) * (MAX_COL_NUM + 1);
+  static PieceIndex constexpr NO_PIECE = MAX_PIECES;
+  // the alternatives follow the order of PieceType, after the empty one
+  std::array<std::variant<std::monostate, Pawn, Knight, Bishop, Rook, Queen,
+                          King>, MAX_PIECES> m_pieces;
+  size_t m_piecesCount = 0;
+  // the index in m_pieces of the piece on each square, or NO_PIECE
+  using Squares = std::array<std::array<PieceIndex, MAX_ROW_NUM+1>,
+                                                    MAX_COL_NUM+1>;
+  static Squares emptySquares();
+  Squares m_board = emptySquares();
+  // one bitboard per colour and piece type, indexed by colour first
+  std::array<Bitboard, 2 * (static_cast<int>(PieceType::King) + 1)>
+                                                          m_pieceBitboards{};
+  std::array<Bitboard, 2> m_colourBitboards{};
+  Bitboard m_occupied = 0;
+  // the number of pieces of each type per colour, packed in a few bits each
+  using MaterialSignature = std::uint32_t;
+  std::array<MaterialSignature, 2> m_material{};
   std::unique_ptr<BoardHasher> m_hasher;
-  std::unordered_map<int, size_t> m_boardHashCount;
+  // the key of every position reached, the current one being the last
+  std::vector<BoardHash> m_positionKeys;
   bool m_threeFoldRepetition = false;
   int m_countSincePawnMoveOrCapture = 0;
-  std::unordered_set<std::reference_wrapper<Piece>,
-                                   PieceRefHasher> m_insufficientMaterial;
   struct PastMove;
   std::vector<PastMove> m_movesHistory;
 };
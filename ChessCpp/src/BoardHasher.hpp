@@ -1,11 +1,17 @@
 #ifndef BOARD_HASHER_H
 #define BOARD_HASHER_H
 
+#include <cstdint>
 #include <optional>
 #include "Piece.hpp"
 
 namespace Chess {
 
+struct Position;
+
+/// Represents the hash of a chessboard configuration.
+using BoardHash = std::uint64_t;
+
 /// An object capable of hashing a chessboard configuration.
 class BoardHasher {
 public:
@@ -17,7 +23,7 @@ public:
                           Coordinates const& destination) = 0;
 
   /// Returns the most recent hash.
-  virtual int hash() = 0;
+  virtual BoardHash hash() = 0;
 
   /**
    Restores the hasher to the state before the last change.
@@ -45,6 +51,12 @@ public:
   */
   virtual void reset() = 0;
 
+  /**
+   Resets the hasher to the position given, taking the key of the position as
+   the hash rather than computing it again.
+  */
+  virtual void reset(Position const& position) = 0;
+
   /// Changes the hash by toggling the current player. White always starts.
   virtual void togglePlayer() = 0;
 
@@ -0,0 +1,47 @@
+#include "Cpu.hpp"
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace Chess {
+
+/// Contains the optional instruction sets found on the CPU.
+struct CpuFeatures {
+  bool bmi2 = false;
+  bool avx2 = false;
+};
+
+/// Queries the CPU for its optional instruction sets.
+CpuFeatures detectCpuFeatures() {
+  CpuFeatures features;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  // these read cpuid and, for AVX2, check the OS saves the vector registers
+  __builtin_cpu_init();
+  features.bmi2 = __builtin_cpu_supports("bmi2");
+  features.avx2 = __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] >= 7) {
+    __cpuid(info, 1);
+    bool osSavesVectors = (info[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6;
+    __cpuidex(info, 7, 0);
+    features.bmi2 = (info[1] & (1 << 8)) != 0;
+    features.avx2 = osSavesVectors && (info[1] & (1 << 5)) != 0;
+  }
+#endif
+  return features;
+}
+
+bool isSupported(InstructionSet set) {
+  static CpuFeatures const features = detectCpuFeatures();
+  switch (set) {
+  case InstructionSet::Portable: return true;
+  case InstructionSet::Bmi2: return features.bmi2;
+  case InstructionSet::Avx2: return features.avx2;
+  }
+  return false;
+}
+
+}
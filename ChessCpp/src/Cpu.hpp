@@ -0,0 +1,24 @@
+#ifndef CHESS_CPU
+#define CHESS_CPU
+
+namespace Chess {
+
+/// Represents a family of instructions which kernels can be specialised for.
+enum class InstructionSet {
+  /// The instructions every supported CPU has, used by the fallback kernels.
+  Portable,
+  /// The x86-64 bit manipulation instructions, including PEXT.
+  Bmi2,
+  /// The x86-64 256-bit integer vector instructions.
+  Avx2
+};
+
+/**
+  Returns true if the CPU running the program supports the given instruction
+  set, false otherwise. The CPU is queried via cpuid once, on the first call.
+*/
+bool isSupported(InstructionSet set);
+
+}
+
+#endif // CHESS_CPU
@@ -1,32 +1,28 @@
 #include "AbstractBoard.hpp"
+#include "Attacks.hpp"
 #include "King.hpp"
 
 namespace Chess {
 
-King::King(Colour colour, AbstractBoard& board): Piece(colour, board) {}
+King::King(Colour colour): Piece(colour) {}
 
 std::string King::name() const {
   return "King";
 }
 
-bool King::isNormalMoveSpecific(Coordinates const& source,
-                               Coordinates const& destination) const {
-  int colDiff = abs(source.column - destination.column);
-  int rowDiff = abs(source.row - destination.row);
-
-  if (colDiff + rowDiff > 2) {
-    return false;
-  }
-  if (colDiff != 1 && rowDiff != 1) {
-    return false;
-  }
+PieceType King::type() const {
+  return PieceType::King;
+}
 
-  return true;
+bool King::isNormalMoveSpecific(AbstractBoard const&,
+                                Coordinates const& source,
+                                Coordinates const& destination) const {
+  return (kingAttacks(toSquare(source)) & squareMask(destination)) != 0;
 }
 
-MoveResult King::move(Coordinates const& source,
+MoveResult King::move(AbstractBoard& board, Coordinates const& source,
                       Coordinates const& destination) {
-  return getMutableBoard().move(*this, source, destination);
+  return board.move(*this, source, destination);
 }
 
 }
@@ -14,16 +14,19 @@ public:
   /// Defines the standard starting position of the black king on a board.
   static auto constexpr BLACK_STD_INIT = Coordinates(4, 7);
 
-  /// Constructs a king of the given colour and associated to a board.
-  King(Colour colour, AbstractBoard& board);
+  /// Constructs a king of the given colour.
+  King(Colour colour);
 
   //! @copydoc AbstractBoard::move(Pawn&,Coordinates const&,Coordinates const&)
-  MoveResult move(Coordinates const& source, 
-                          Coordinates const& destination) override;
+  MoveResult move(AbstractBoard& board, Coordinates const& source,
+                  Coordinates const& destination) override;
 
   /// Returns "King".
   std::string name() const override;
 
+  /// Returns PieceType::King.
+  PieceType type() const override;
+
 private:
   /**
    Checks for king-specific moves and returns true if the supplied move
@@ -31,8 +34,9 @@ private:
    This function does not handle castling, as the Board is considered
    responsible for it.
   */
-  bool isNormalMoveSpecific(Coordinates const& source,
-                           Coordinates const& destination) const override;
+  bool isNormalMoveSpecific(AbstractBoard const& board,
+                            Coordinates const& source,
+                            Coordinates const& destination) const override;
 };
 
 }
@@ -1,5 +1,5 @@
 #include "AbstractBoard.hpp"
-#include <cmath>
+#include "Attacks.hpp"
 #include "Knight.hpp"
 
 namespace Chess {
@@ -9,25 +9,26 @@ std::vector<Coordinates> const Knight::WHITE_STD_INIT =
 std::vector<Coordinates> const Knight::BLACK_STD_INIT = 
                                         {Coordinates(1, 7), Coordinates(6, 7)};
 
-Knight::Knight(Colour colour, AbstractBoard& board): 
-                                                PromotionPiece(colour, board) {}
+Knight::Knight(Colour colour): PromotionPiece(colour) {}
 
-bool Knight::isNormalMoveSpecific(Coordinates const& source,
-                               Coordinates const& destination) const {
-  int rowDiff = abs(source.row - destination.row);
-  int colDiff = abs(source.column - destination.column);
-
-  // L-shape is modeled as row and column differences
-  return (rowDiff == 2 && colDiff == 1) || (rowDiff == 1 && colDiff == 2);
+bool Knight::isNormalMoveSpecific(AbstractBoard const&,
+                                  Coordinates const& source,
+                                  Coordinates const& destination) const {
+  // the L-shapes from every square are tabulated at compile time
+  return (knightAttacks(toSquare(source)) & squareMask(destination)) != 0;
 }
 
 std::string Knight::name() const {
   return "Knight";
 }
 
-MoveResult Knight::move(Coordinates const& source,
+PieceType Knight::type() const {
+  return PieceType::Knight;
+}
+
+MoveResult Knight::move(AbstractBoard& board, Coordinates const& source,
                         Coordinates const& destination) {
-  return getMutableBoard().move(*this, source, destination);
+  return board.move(*this, source, destination);
 }
 
 }
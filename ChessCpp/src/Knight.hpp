@@ -20,23 +20,27 @@ public:
   */
   static std::vector<Coordinates> const BLACK_STD_INIT;
 
-  /// Constructs a knight of the given colour and associated to a board.
-  Knight(Colour colour, AbstractBoard& board);
+  /// Constructs a knight of the given colour.
+  Knight(Colour colour);
 
   //! @copydoc AbstractBoard::move(Pawn&,Coordinates const&,Coordinates const&)
-  MoveResult move(Coordinates const& source,
-                          Coordinates const& destination) override;
+  MoveResult move(AbstractBoard& board, Coordinates const& source,
+                  Coordinates const& destination) override;
 
   /// Returns "Knight"
   std::string name() const override;
 
+  /// Returns PieceType::Knight.
+  PieceType type() const override;
+
 private:
   /**
    Checks for knight-specific moves and returns true if the given move
    is valid, false otherwise.
   */
-  bool isNormalMoveSpecific(Coordinates const& source,
-                           Coordinates const& destination) const override;
+  bool isNormalMoveSpecific(AbstractBoard const& board,
+                            Coordinates const& source,
+                            Coordinates const& destination) const override;
 };
 
 }
@@ -0,0 +1,153 @@
+#ifndef CHESS_MOVE
+#define CHESS_MOVE
+
+#include <array>
+#include "Bitboard.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include "Utils.hpp"
+#include <utility>
+
+namespace Chess {
+
+/**
+  Represents a move from a source to a destination, packed in 16 bits.
+  Castling is represented by the move of the king, whereas a promotion
+  carries the piece chosen. Squares are numbered as in Bitboard.
+*/
+class Move {
+public:
+  /// Describes what is special about a move, if anything.
+  enum class Kind : std::uint16_t { Normal = 0, Promotion, EnPassant, Castling };
+
+  /// Constructs a move from A1 to A1, which is never valid.
+  constexpr Move() = default;
+
+  /**
+    Constructs a move which is a promotion if an option is given.
+    The coordinates must be within the board limits.
+  */
+  constexpr Move(Coordinates const& source, Coordinates const& destination,
+                 std::optional<PromotionOption> promotion = std::nullopt):
+    Move(source, destination, promotion ? Kind::Promotion : Kind::Normal,
+         promotion.value_or(PromotionOption::Knight)) {}
+
+  /**
+    Constructs a move of the given kind, which must not be a promotion.
+    The coordinates must be within the board limits.
+  */
+  constexpr Move(Coordinates const& source, Coordinates const& destination,
+                 Kind kind):
+    Move(source, destination, kind, PromotionOption::Knight) {}
+
+  /// Returns the source of the move.
+  constexpr Coordinates source() const {
+    return toCoordinates(m_data & SQUARE_MASK);
+  }
+
+  /// Returns the destination of the move.
+  constexpr Coordinates destination() const {
+    return toCoordinates((m_data >> DESTINATION_SHIFT) & SQUARE_MASK);
+  }
+
+  /// Returns the piece chosen for a promotion, or an empty optional.
+  constexpr std::optional<PromotionOption> promotion() const {
+    if (kind() != Kind::Promotion) {
+      return std::nullopt;
+    }
+    return static_cast<PromotionOption>((m_data >> PROMOTION_SHIFT) & 3);
+  }
+
+  /// Returns what is special about the move, if anything.
+  constexpr Kind kind() const {
+    return static_cast<Kind>(m_data >> KIND_SHIFT);
+  }
+
+  /// Returns true if source, destination and promotion are identical.
+  constexpr bool operator== (Move const& other) const {
+    return (m_data & ~KIND_MASK) == (other.m_data & ~KIND_MASK) &&
+           promotion() == other.promotion();
+  }
+
+  /// Returns true if source, destination or promotion are different.
+  constexpr bool operator!= (Move const& other) const {
+    return !operator==(other);
+  }
+
+private:
+  static int constexpr DESTINATION_SHIFT = 6;
+  static int constexpr PROMOTION_SHIFT = 12;
+  static int constexpr KIND_SHIFT = 14;
+  static std::uint16_t constexpr SQUARE_MASK = 63;
+  static std::uint16_t constexpr KIND_MASK = 3 << KIND_SHIFT;
+
+  constexpr Move(Coordinates const& source, Coordinates const& destination,
+                 Kind kind, PromotionOption promotion):
+    m_data(static_cast<std::uint16_t>(toSquare(source) |
+             toSquare(destination) << DESTINATION_SHIFT |
+             static_cast<int>(promotion) << PROMOTION_SHIFT |
+             static_cast<int>(kind) << KIND_SHIFT)) {}
+
+  std::uint16_t m_data = 0;
+};
+
+static_assert(sizeof(Move) == 2, "Moves must be packed in 16 bits");
+
+/**
+  Represents a list of moves stored in place rather than on the heap, with
+  room for the legal moves of any chess position.
+*/
+class MoveList {
+public:
+  using value_type = Move;
+  using iterator = Move*;
+  using const_iterator = Move const*;
+
+  /// Defines the maximum number of moves held.
+  static std::size_t constexpr CAPACITY = 256;
+
+  /// Appends a move. The list must not be full.
+  void push_back(Move const& move) {
+    m_moves[m_size++] = move;
+  }
+
+  /// Constructs a move at the end of the list. The list must not be full.
+  template <typename... Args>
+  void emplace_back(Args&&... args) {
+    m_moves[m_size++] = Move(std::forward<Args>(args)...);
+  }
+
+  /// Removes all moves.
+  void clear() {
+    m_size = 0;
+  }
+
+  /// Returns the number of moves held.
+  std::size_t size() const {
+    return m_size;
+  }
+
+  /// Returns true if the list holds no moves, false otherwise.
+  bool empty() const {
+    return m_size == 0;
+  }
+
+  /// Returns the move at the given index, which must be less than size().
+  Move const& operator[](std::size_t index) const {
+    return m_moves[index];
+  }
+
+  iterator begin() { return m_moves.data(); }
+  iterator end() { return m_moves.data() + m_size; }
+  const_iterator begin() const { return m_moves.data(); }
+  const_iterator end() const { return m_moves.data() + m_size; }
+
+private:
+  std::array<Move, CAPACITY> m_moves;
+  std::size_t m_size = 0;
+};
+
+}
+
+#endif // CHESS_MOVE
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include "Board.hpp"
+#include "MoveAttempt.hpp"
+#include <stdexcept>
+#include <string_view>
+
+namespace Chess {
+
+/// Returns the name of the colour given.
+std::string_view colourName(Colour colour) {
+  return colour == Colour::White ? "White" : "Black";
+}
+
+MoveAttempt::InvalidText::InvalidText(std::string_view text):
+  m_size(static_cast<std::uint8_t>(std::min(text.size(), MAX_SIZE))) {
+  std::copy_n(text.begin(), m_size, m_characters.begin());
+}
+
+std::string_view MoveAttempt::InvalidText::view() const {
+  return std::string_view(m_characters.data(), m_size);
+}
+
+MoveAttempt::MoveAttempt(MoveResult result): m_outcome(std::move(result)) {}
+
+MoveAttempt::MoveAttempt(Error error): m_outcome(error) {}
+
+bool MoveAttempt::hasValue() const {
+  return std::holds_alternative<MoveResult>(m_outcome);
+}
+
+MoveAttempt::operator bool() const {
+  return hasValue();
+}
+
+MoveResult const& MoveAttempt::value() const {
+  if (!hasValue()) {
+    throw InvalidMove(errorMessage(), errorCode());
+  }
+  return std::get<MoveResult>(m_outcome);
+}
+
+InvalidMove::ErrorCode MoveAttempt::errorCode() const {
+  return error().code;
+}
+
+std::string MoveAttempt::errorMessage() const {
+  auto const& err = error();
+  std::string player(colourName(err.player));
+  switch (err.code) {
+  case InvalidMove::ErrorCode::INVALID_COORDINATES:
+    if (err.invalidText) {
+      if (auto reason = Board::invalidCoordinatesReason(
+                                                  err.invalidText->view())) {
+        return *reason;
+      }
+    }
+    return "Coordinates are invalid or beyond the board limits";
+  case InvalidMove::ErrorCode::WRONG_TURN:
+    return std::string("It is not ") + std::string(colourName(
+      err.player == Colour::White ? Colour::Black : Colour::White)) +
+      "'s turn to move";
+  case InvalidMove::ErrorCode::NO_SOURCE_PIECE:
+    return "There is no piece at position " +
+           Board::coordinatesToString(err.source);
+  case InvalidMove::ErrorCode::PIECE_LOGIC_ERROR:
+    return player + "'s " + std::string(pieceTypeName(err.piece)) +
+           " cannot move from " + Board::coordinatesToString(err.source) +
+           " to " + Board::coordinatesToString(err.destination);
+  case InvalidMove::ErrorCode::CHECK_ERROR:
+    return player + "'s move is invalid as they would be in check";
+  case InvalidMove::ErrorCode::PENDING_PROMOTION:
+    return "Promote pawn before continuing";
+  case InvalidMove::ErrorCode::GAME_OVER:
+    return "Game is already over, please reset";
+  }
+  return "Invalid move";
+}
+
+MoveAttempt::Error const& MoveAttempt::error() const {
+  if (hasValue()) {
+    throw std::logic_error("The move attempted was valid");
+  }
+  return std::get<Error>(m_outcome);
+}
+
+}
@@ -0,0 +1,95 @@
+#ifndef CHESS_MOVE_ATTEMPT
+#define CHESS_MOVE_ATTEMPT
+
+#include <array>
+#include <cstdint>
+#include "Exceptions.hpp"
+#include "MoveResult.hpp"
+#include <optional>
+#include <string>
+#include <string_view>
+#include "Utils.hpp"
+#include <variant>
+
+namespace Chess {
+
+/**
+  Holds either the result of a valid move or the reason why a move is invalid,
+  in the manner of std::expected. The explanation of an invalid move is only
+  put into words when requested, so that rejecting a move does not allocate.
+*/
+class MoveAttempt {
+public:
+  /**
+    Holds the text of coordinates which could not be parsed, stored in place
+    so that rejecting them does not allocate. Longer texts are cut short.
+  */
+  class InvalidText {
+  public:
+    /// Defines the most characters kept.
+    static std::size_t constexpr MAX_SIZE = 15;
+
+    explicit InvalidText(std::string_view text);
+
+    /// Returns the text kept, up to MAX_SIZE characters.
+    std::string_view view() const;
+
+  private:
+    std::array<char, MAX_SIZE> m_characters{};
+    std::uint8_t m_size = 0;
+  };
+
+  /// Describes an invalid move with the details needed to explain it.
+  struct Error {
+    /// The type of invalid move.
+    InvalidMove::ErrorCode code;
+    /// The player whose turn it was.
+    Colour player = Colour::White;
+    /// The type of the piece at the source, if any.
+    PieceType piece = PieceType::Pawn;
+    /// The source of the move.
+    Coordinates source;
+    /// The destination of the move.
+    Coordinates destination;
+    /// The text of the coordinates which could not be parsed, if any.
+    std::optional<InvalidText> invalidText;
+  };
+
+  /// Constructs an attempt which resulted in a valid move.
+  MoveAttempt(MoveResult result);
+  /// Constructs an attempt which was rejected for the given reason.
+  MoveAttempt(Error error);
+
+  /// Returns true if the move was valid, false otherwise.
+  bool hasValue() const;
+  /// Returns true if the move was valid, false otherwise.
+  explicit operator bool() const;
+
+  /**
+    Returns the result of the move.
+    Throws an InvalidMove exception describing the error if the move was
+    invalid.
+  */
+  MoveResult const& value() const;
+
+  /**
+    Returns the code of the error which made the move invalid.
+    Throws std::logic_error if the move was valid.
+  */
+  InvalidMove::ErrorCode errorCode() const;
+
+  /**
+    Returns an explanation of why the move is invalid, such as
+    "White's Rook cannot move from A1 to A5".
+    Throws std::logic_error if the move was valid.
+  */
+  std::string errorMessage() const;
+
+private:
+  Error const& error() const;
+
+  std::variant<MoveResult, Error> m_outcome;
+};
+
+}
+#endif // CHESS_MOVE_ATTEMPT
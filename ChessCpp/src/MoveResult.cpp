@@ -4,14 +4,46 @@ namespace Chess {
 
 MoveResult::MoveResult(GameState state): m_gameState(state) {}
 
-MoveResult::MoveResult(GameState gameState, std::string capturedPieceName):
-   m_gameState(gameState), m_capturedPieceName(std::move(capturedPieceName)) {}
+MoveResult::MoveResult(GameState state, PieceType movedPiece,
+                       Move const& move,
+                       std::optional<PieceType> capturedPiece):
+  m_move(move), m_gameState(state),
+  m_movedPiece(static_cast<std::uint8_t>(movedPiece)),
+  m_capturedPiece(capturedPiece ? static_cast<std::uint8_t>(*capturedPiece) :
+                                  NONE) {}
+
+MoveResult::MoveResult(GameState state, CastlingType castlingType,
+                       Move const& move):
+  m_move(move), m_gameState(state),
+  m_movedPiece(static_cast<std::uint8_t>(PieceType::King)),
+  m_castlingType(static_cast<std::uint8_t>(castlingType)) {}
+
+std::optional<PieceType> MoveResult::capturedPiece() const {
+  if (m_capturedPiece == NONE) {
+    return std::nullopt;
+  }
+  return static_cast<PieceType>(m_capturedPiece);
+}
 
-MoveResult::MoveResult(GameState state, CastlingType castlingType) :
-  m_gameState(state), m_castlingType(castlingType) {}
+std::optional<std::string_view> MoveResult::capturedPieceName() const {
+  if (auto piece = capturedPiece()) {
+    return pieceTypeName(*piece);
+  }
+  return std::nullopt;
+}
 
-std::optional<std::string> MoveResult::capturedPieceName() const {
-  return m_capturedPieceName;
+std::optional<PieceType> MoveResult::movedPiece() const {
+  if (m_movedPiece == NONE) {
+    return std::nullopt;
+  }
+  return static_cast<PieceType>(m_movedPiece);
+}
+
+std::optional<Move> MoveResult::move() const {
+  if (m_movedPiece == NONE) {
+    return std::nullopt;
+  }
+  return m_move;
 }
 
 MoveResult::GameState MoveResult::gameState() const {
@@ -19,7 +51,10 @@ MoveResult::GameState MoveResult::gameState() const {
 }
 
 std::optional<CastlingType> MoveResult::castlingType() const {
-    return m_castlingType;
+  if (m_castlingType == NONE) {
+    return std::nullopt;
+  }
+  return static_cast<CastlingType>(m_castlingType);
 }
 
-}
\ No newline at end of file
+}
@@ -1,17 +1,23 @@
 #ifndef CHESS_MOVE_RESULT
 #define CHESS_MOVE_RESULT
 
+#include <cstdint>
+#include "Move.hpp"
 #include <optional>
-#include <string>
+#include <string_view>
+#include <type_traits>
 #include "Utils.hpp"
 
 namespace Chess {
 
-/// Represents the outcome of a valid move.
+/**
+  Represents the outcome of a valid move. It holds no strings and is
+  trivially copyable, so that reporting a move never allocates.
+*/
 class MoveResult {
 public:
   /// Represents the state of the game after the move.
-  enum class GameState {
+  enum class GameState : std::uint8_t {
     /// A normal state without checks, checkmates or other similar events.
     NORMAL,
     /// The opponent is in check.
@@ -30,18 +36,40 @@ public:
     AWAITING_PROMOTION
   };
 
-  /// Constructs a move result with the given state.
+  /// Constructs a move result with the given state and no further details.
   MoveResult(GameState state);
-  /// Constructs a move result with a state and the name of a captured piece.
-  MoveResult(GameState state, std::string capturedPieceName);
-  /// Constructs a move result with a state and a castling type.
-  MoveResult(GameState state, CastlingType castlingType);
+  /**
+   Constructs the result of the given move of a piece of the given type,
+   which captured a piece of the type given, if any.
+  */
+  MoveResult(GameState state, PieceType movedPiece, Move const& move,
+             std::optional<PieceType> capturedPiece = std::nullopt);
+  /**
+   Constructs the result of a castling, where the move given is the one of
+   the king.
+  */
+  MoveResult(GameState state, CastlingType castlingType, Move const& move);
 
   /**
-   Returns the name of the captured piece, or an empty optional if no piece
+   Returns the type of the captured piece, or an empty optional if no piece
    was captured.
   */
-  std::optional<std::string> capturedPieceName() const;
+  std::optional<PieceType> capturedPiece() const;
+
+  /**
+   Returns the name of the captured piece (e.g. "Rook"), or an empty optional
+   if no piece was captured. The name refers to a static string.
+  */
+  std::optional<std::string_view> capturedPieceName() const;
+
+  /// Returns the type of the piece moved, or an empty optional if unknown.
+  std::optional<PieceType> movedPiece() const;
+
+  /**
+   Returns the move made, including the promotion chosen, or an empty
+   optional if unknown.
+  */
+  std::optional<Move> move() const;
 
   /// Returns the state of the game after the move.
   GameState gameState() const;
@@ -50,10 +78,19 @@ public:
   std::optional<CastlingType> castlingType() const;
 
 private:
+  static std::uint8_t constexpr NONE = 0xFF;
+
+  Move m_move;
   GameState m_gameState;
-  std::optional<std::string> m_capturedPieceName;
-  std::optional<CastlingType> m_castlingType;
+  std::uint8_t m_movedPiece = NONE;
+  std::uint8_t m_capturedPiece = NONE;
+  std::uint8_t m_castlingType = NONE;
 };
 
+static_assert(std::is_trivially_copyable_v<MoveResult>,
+              "Move results must be copyable with memcpy");
+static_assert(sizeof(MoveResult) <= 2 * sizeof(void*),
+              "Move results must fit in a pair of registers");
+
 }
 #endif // CHESS_MOVE_RESULT
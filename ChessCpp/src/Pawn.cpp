@@ -1,46 +1,51 @@
 #include "AbstractBoard.hpp"
+#include "Attacks.hpp"
 #include <iostream>
 #include "Pawn.hpp"
 
 namespace Chess {
 
-Pawn::Pawn(Colour colour, AbstractBoard& board): Piece(colour, board) {}
+Pawn::Pawn(Colour colour): Piece(colour) {}
 
 std::string Pawn::name() const {
   return "Pawn";
 }
 
-bool Pawn::isNormalMoveSpecific(Coordinates const& source,
-                               Coordinates const& destination) const {
+PieceType Pawn::type() const {
+  return PieceType::Pawn;
+}
+
+bool Pawn::isNormalMoveSpecific(AbstractBoard const& board,
+                                Coordinates const& source,
+                                Coordinates const& destination) const {
+  auto piece = board.at(destination);
+
+  // a step diagonally forward captures, either normally or en passant
+  if (pawnAttacks(getColour(), toSquare(source)) & squareMask(destination)) {
+    return piece || board.isValidEnPassant(*this, source, destination);
+  }
+
   int forwardSteps = destination.row - source.row;
   int horizontalSteps = abs(destination.column - source.column);
 
   // white only moves in increasing row direction, black the opposite
   // therefore, 'forward' is relative to the colour
   forwardSteps *= (getColour() == Colour::White) ? 1 : -1;
-  auto piece = getBoard().at(destination);
 
-  // return true only for: normal pawn step, capturing one step diagonally,
-  // double step as first move and en passant
+  // return true only for: normal pawn step and double step as first move
   if (forwardSteps == 1 && horizontalSteps == 0 && !piece) {
     return true;
   }
-  if (forwardSteps == 1 && horizontalSteps == 1 && piece) {
-    return true;
-  }
-  if (getBoard().isValidEnPassant(*this, source, destination)) {
-    return true;
-  }
   if (forwardSteps == 2 && horizontalSteps == 0 && !piece &&
                                                         !getMovedStatus()) {
-    return getBoard().isFreeColumn(source, destination.row);
+    return board.isFreeColumn(source, destination.row);
   }
   return false;
 }
 
-MoveResult Pawn::move(Coordinates const& source,
+MoveResult Pawn::move(AbstractBoard& board, Coordinates const& source,
                       Coordinates const& destination) {
-  return getMutableBoard().move(*this, source, destination);
+  return board.move(*this, source, destination);
 }
 
 std::vector<Coordinates> const Pawn::WHITE_STD_INIT = 
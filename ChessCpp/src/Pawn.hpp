@@ -20,23 +20,27 @@ public:
   */
   static std::vector<Coordinates> const BLACK_STD_INIT;
 
-  // Constructs a pawn of the specified colour and associated to a board.
-  Pawn(Colour colour, AbstractBoard& board);
+  // Constructs a pawn of the specified colour.
+  Pawn(Colour colour);
 
   //! @copydoc AbstractBoard::move(Pawn&,Coordinates const&,Coordinates const&)
-  MoveResult move(Coordinates const& source,
-                          Coordinates const& destination) override;
+  MoveResult move(AbstractBoard& board, Coordinates const& source,
+                  Coordinates const& destination) override;
 
   /// Returns "Pawn".
   std::string name() const override;
 
+  /// Returns PieceType::Pawn.
+  PieceType type() const override;
+
 private:
   /**
    Checks for pawn-specific moves and returns true if the supplied move
    is valid in the associated board, false otherwise.
   */
-  bool isNormalMoveSpecific(Coordinates const& source,
-                           Coordinates const& destination) const override;
+  bool isNormalMoveSpecific(AbstractBoard const& board,
+                            Coordinates const& source,
+                            Coordinates const& destination) const override;
 };
 
 }
@@ -0,0 +1,356 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <optional>
+#include "Perft.hpp"
+#include <thread>
+
+/// Defines the number of bits of a table entry used to store the depth.
+int constexpr PERFT_DEPTH_BITS = 8;
+/// Defines how many tasks per thread are wanted to keep all threads busy.
+size_t constexpr PERFT_TASKS_PER_THREAD = 4;
+
+namespace Chess {
+
+/// Converts a list of string coordinates (e.g. "A2") into coordinates.
+std::vector<Coordinates> coordinatesOf(
+                              std::initializer_list<std::string_view> coords) {
+  std::vector<Coordinates> result;
+  result.reserve(coords.size());
+  for (auto const& coord : coords) {
+    result.push_back(Board::stringToCoordinates(coord));
+  }
+  return result;
+}
+
+/**
+  Stores leaf counts by position hash and depth, so that positions reached
+  through different move orders are counted once. Threads can share it
+  without locking: every entry also stores its data xor-ed with the hash, so
+  an entry mixing the writes of two threads fails the check on lookup and is
+  treated as missing.
+*/
+class PerftTable {
+public:
+  explicit PerftTable(std::size_t entries):
+               m_entries(entries == 0 ? 0 : std::size_t(1) << floorLog2(entries)),
+               m_mask(m_entries.empty() ? 0 : m_entries.size() - 1) {}
+
+  /// Returns the count stored for the hash and depth, if any.
+  std::optional<std::uint64_t> find(BoardHash hash, int depth) const {
+    auto const& entry = m_entries[hash & m_mask];
+    auto data = entry.data.load(std::memory_order_relaxed);
+    auto check = entry.check.load(std::memory_order_relaxed);
+    if ((data ^ check) != hash ||
+        (data & ((1u << PERFT_DEPTH_BITS) - 1)) != static_cast<unsigned>(depth)) {
+      return std::nullopt;
+    }
+    return data >> PERFT_DEPTH_BITS;
+  }
+
+  /// Stores the count for the hash and depth, replacing any previous entry.
+  void store(BoardHash hash, int depth, std::uint64_t nodes) {
+    auto& entry = m_entries[hash & m_mask];
+    auto data = (nodes << PERFT_DEPTH_BITS) | static_cast<std::uint64_t>(depth);
+    entry.data.store(data, std::memory_order_relaxed);
+    entry.check.store(data ^ hash, std::memory_order_relaxed);
+  }
+
+  /// Returns true if the table has no entries, false otherwise.
+  bool disabled() const {
+    return m_entries.empty();
+  }
+
+private:
+  static int floorLog2(std::size_t value) {
+    int log = 0;
+    while (value >>= 1) {
+      ++log;
+    }
+    return log;
+  }
+
+  struct Entry {
+    std::atomic<std::uint64_t> data{0};
+    std::atomic<std::uint64_t> check{0};
+  };
+  std::vector<Entry> m_entries;
+  std::size_t m_mask;
+};
+
+/**
+  Counts the leaves below the current position. The lists hold the moves of
+  each ply, so that they are allocated once rather than at every node.
+  Counts are looked up and stored in the table, if one is given.
+*/
+std::uint64_t countLeaves(Board& board, int depth,
+                          std::vector<MoveList>& lists,
+                          PerftTable* table = nullptr) {
+  auto& moves = lists[depth - 1];
+  board.generateLegalMoves(moves);
+  if (depth == 1) {
+    return moves.size();
+  }
+
+  BoardHash hash = 0;
+  if (table) {
+    hash = board.hash();
+    if (auto nodes = table->find(hash, depth)) {
+      return *nodes;
+    }
+  }
+
+  std::uint64_t nodes = 0;
+  for (auto const& move : moves) {
+    board.move(move);
+    nodes += countLeaves(board, depth - 1, lists, table);
+    board.undoLastMove();
+  }
+
+  if (table) {
+    table->store(hash, depth, nodes);
+  }
+  return nodes;
+}
+
+/**
+  Counts the leaves below the position given, playing each move on a copy.
+  The lists hold the moves of each ply, as they do for boards.
+*/
+std::uint64_t countLeaves(Position const& position, int depth,
+                          std::vector<MoveList>& lists) {
+  auto& moves = lists[depth - 1];
+  position.generateLegalMoves(moves);
+  if (depth == 1) {
+    return moves.size();
+  }
+
+  std::uint64_t nodes = 0;
+  for (auto const& move : moves) {
+    auto next = position;
+    next.play(move);
+    nodes += countLeaves(next, depth - 1, lists);
+  }
+  return nodes;
+}
+
+std::uint64_t perft(Position const& position, int depth) {
+  if (depth <= 0) {
+    return 1;
+  }
+  std::vector<MoveList> lists(depth);
+  return countLeaves(position, depth, lists);
+}
+
+std::uint64_t perft(Board& board, int depth) {
+  if (depth <= 0) {
+    return 1;
+  }
+  std::vector<MoveList> lists(depth);
+  return countLeaves(board, depth, lists);
+}
+
+std::vector<PerftDivision> perftDivide(Board& board, int depth) {
+  std::vector<PerftDivision> divisions;
+  if (depth <= 0) {
+    return divisions;
+  }
+
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  std::vector<MoveList> lists(depth);
+  for (auto const& move : moves) {
+    board.move(move);
+    std::uint64_t nodes = 1;
+    if (depth > 1) {
+      nodes = countLeaves(board, depth - 1, lists);
+    }
+    board.undoLastMove();
+    divisions.push_back({move, nodes});
+  }
+  return divisions;
+}
+
+/// Represents the moves leading from the root to a subtree to count.
+struct PerftTask {
+  size_t division = 0;
+  std::vector<Move> moves;
+};
+
+/**
+  Lists the subtrees to count for the given depth. Replies to the root moves
+  are split too if there would not be enough tasks to keep the threads busy.
+*/
+std::vector<PerftTask> perftTasks(Board& board, int depth,
+                                  std::vector<PerftDivision>& divisions,
+                                  unsigned threads) {
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  for (auto const& move : moves) {
+    divisions.push_back({move, 0});
+  }
+
+  std::vector<PerftTask> tasks;
+  bool splitReplies = depth > 2 &&
+                      moves.size() < threads * PERFT_TASKS_PER_THREAD;
+  for (size_t i = 0; i < moves.size(); ++i) {
+    if (!splitReplies) {
+      tasks.push_back({i, {moves[i]}});
+      continue;
+    }
+
+    MoveList replies;
+    board.move(moves[i]);
+    board.generateLegalMoves(replies);
+    board.undoLastMove();
+    for (auto const& reply : replies) {
+      tasks.push_back({i, {moves[i], reply}});
+    }
+  }
+  return tasks;
+}
+
+std::vector<PerftDivision> perftDivideParallel(
+                                      std::function<Board()> const& build,
+                                      int depth,
+                                      ParallelPerftOptions const& options) {
+  std::vector<PerftDivision> divisions;
+  if (depth <= 0) {
+    return divisions;
+  }
+
+  auto threads = options.threads;
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  auto root = build();
+  auto tasks = perftTasks(root, depth, divisions, threads);
+  threads = static_cast<unsigned>(std::min<size_t>(threads, tasks.size()));
+
+  PerftTable table(options.tableEntries);
+  std::vector<std::uint64_t> taskNodes(tasks.size(), 0);
+  std::atomic<size_t> nextTask{0};
+  std::vector<std::exception_ptr> errors(threads);
+  auto work = [&](unsigned worker) {
+    try {
+      auto board = build();
+      std::vector<MoveList> lists(depth);
+      for (auto i = nextTask++; i < tasks.size(); i = nextTask++) {
+        auto const& moves = tasks[i].moves;
+        for (auto const& move : moves) {
+          board.move(move);
+        }
+        auto remainingDepth = depth - static_cast<int>(moves.size());
+        taskNodes[i] = remainingDepth == 0 ? 1 :
+          countLeaves(board, remainingDepth, lists,
+                      table.disabled() ? nullptr : &table);
+        for (size_t j = 0; j < moves.size(); ++j) {
+          board.undoLastMove();
+        }
+      }
+    } catch (...) {
+      errors[worker] = std::current_exception();
+      // stop the other threads from picking up further tasks
+      nextTask = tasks.size();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (unsigned i = 1; i < threads; ++i) {
+    workers.emplace_back(work, i);
+  }
+  if (threads > 0) {
+    work(0);
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  for (auto const& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  for (size_t i = 0; i < tasks.size(); ++i) {
+    divisions[tasks[i].division].nodes += taskNodes[i];
+  }
+  return divisions;
+}
+
+std::uint64_t perftParallel(std::function<Board()> const& build, int depth,
+                            ParallelPerftOptions const& options) {
+  if (depth <= 0) {
+    return 1;
+  }
+  std::uint64_t nodes = 0;
+  for (auto const& division : perftDivideParallel(build, depth, options)) {
+    nodes += division.nodes;
+  }
+  return nodes;
+}
+
+std::vector<PerftPosition> const& standardPerftPositions() {
+  static std::vector<PerftPosition> const positions = {
+    {"startpos",
+     []() { return Board(); },
+     {20, 400, 8902, 197281, 4865609, 119060324}},
+
+    // r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq -
+    {"kiwipete",
+     []() {
+       return Board(
+         coordinatesOf({"A2", "B2", "C2", "F2", "G2", "H2", "D5", "E4"}),
+         coordinatesOf({"A1", "H1"}), coordinatesOf({"C3", "E5"}),
+         coordinatesOf({"D2", "E2"}), coordinatesOf({"F3"}),
+         Board::stringToCoordinates("E1"),
+         coordinatesOf({"A7", "C7", "D7", "F7", "E6", "G6", "B4", "H3"}),
+         coordinatesOf({"A8", "H8"}), coordinatesOf({"B6", "F6"}),
+         coordinatesOf({"A6", "G7"}), coordinatesOf({"E7"}),
+         Board::stringToCoordinates("E8"));
+     },
+     {48, 2039, 97862, 4085603, 193690690}},
+
+    // 8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - -
+    {"position3",
+     []() {
+       return Board(coordinatesOf({"B5", "E2", "G2"}), coordinatesOf({"B4"}),
+                    {}, {}, {}, Board::stringToCoordinates("A5"),
+                    coordinatesOf({"C7", "D6", "F4"}), coordinatesOf({"H5"}),
+                    {}, {}, {}, Board::stringToCoordinates("H4"));
+     },
+     {14, 191, 2812, 43238, 674624, 11030083}},
+
+    // r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq -
+    {"position4",
+     []() {
+       return Board(
+         coordinatesOf({"A7", "B5", "C4", "E4", "A2", "D2", "G2", "H2"}),
+         coordinatesOf({"A1", "F1"}), coordinatesOf({"H6", "F3"}),
+         coordinatesOf({"A4", "B4"}), coordinatesOf({"D1"}),
+         Board::stringToCoordinates("G1"),
+         coordinatesOf({"B7", "C7", "D7", "F7", "G7", "H7", "B2"}),
+         coordinatesOf({"A8", "H8"}), coordinatesOf({"F6", "A5"}),
+         coordinatesOf({"B6", "G6"}), coordinatesOf({"A3"}),
+         Board::stringToCoordinates("E8"));
+     },
+     {6, 264, 9467, 422333, 15833292}},
+
+    // rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ -
+    {"position5",
+     []() {
+       return Board(
+         coordinatesOf({"A2", "B2", "C2", "G2", "H2", "D7"}),
+         coordinatesOf({"A1", "H1"}), coordinatesOf({"B1", "E2"}),
+         coordinatesOf({"C1", "C4"}), coordinatesOf({"D1"}),
+         Board::stringToCoordinates("E1"),
+         coordinatesOf({"A7", "B7", "C6", "F7", "G7", "H7"}),
+         coordinatesOf({"A8", "H8"}), coordinatesOf({"B8", "F2"}),
+         coordinatesOf({"C8", "E7"}), coordinatesOf({"D8"}),
+         Board::stringToCoordinates("F8"));
+     },
+     {44, 1486, 62379, 2103487, 89941194}},
+  };
+  return positions;
+}
+
+}
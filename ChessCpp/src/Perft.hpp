@@ -0,0 +1,100 @@
+#ifndef CHESS_PERFT
+#define CHESS_PERFT
+
+#include "Board.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "Position.hpp"
+#include <string_view>
+#include <vector>
+
+namespace Chess {
+
+/**
+  Counts the leaves of the tree of legal moves of the given depth, starting
+  from the current position of the board. Each promotion option counts as a
+  separate move. The board is restored to its original position before
+  returning.
+
+  Since the board adjudicates draws by itself (e.g. insufficient material),
+  counts may differ from the ones of other engines in positions close to such
+  draws. Returns 1 if the depth is zero or negative.
+*/
+std::uint64_t perft(Board& board, int depth);
+
+/**
+  Performs perft as described in perft(Board&,int), applying each move to a
+  copy of the position rather than making and undoing it on a board.
+  Since positions keep no history, draws by repetition are never adjudicated.
+*/
+std::uint64_t perft(Position const& position, int depth);
+
+/// Represents the number of leaves reached through one of the root moves.
+struct PerftDivision {
+  Move move;
+  std::uint64_t nodes = 0;
+};
+
+/**
+  Performs perft as described in perft(Board&,int), but returns the leaves
+  reached through each legal move of the current player separately.
+  Returns an empty list if the depth is zero or negative.
+*/
+std::vector<PerftDivision> perftDivide(Board& board, int depth);
+
+/// Configures how perft is spread across threads.
+struct ParallelPerftOptions {
+  /// The number of threads used. Zero selects one thread per core.
+  unsigned threads = 0;
+  /**
+    The number of entries of the table shared by the threads to count
+    transpositions once. Each entry takes 16 bytes and the count is rounded
+    down to a power of two. Zero disables the table.
+  */
+  std::size_t tableEntries = std::size_t(1) << 20;
+};
+
+/**
+  Performs perft as described in perftDivide(Board&,int), splitting the root
+  moves (and the replies to them, if there are few root moves) across
+  threads. Each thread calls the function given to build its own copy of the
+  position, so it must always return a board in the same position.
+
+  Positions already counted are looked up in a lock-free table keyed by the
+  hash of the board. This assumes the count below a position depends on its
+  hash and depth only, which holds unless the depth is enough for the board
+  to adjudicate a draw by repetition or by the 75-move rule.
+  Rethrows any exception thrown while building the boards.
+*/
+std::vector<PerftDivision> perftDivideParallel(
+                                      std::function<Board()> const& build,
+                                      int depth,
+                                      ParallelPerftOptions const& options = {});
+
+/**
+  Performs perft as described in perftDivideParallel, returning the total
+  number of leaves. Returns 1 if the depth is zero or negative.
+*/
+std::uint64_t perftParallel(std::function<Board()> const& build, int depth,
+                            ParallelPerftOptions const& options = {});
+
+/// Represents a position commonly used to verify move generation.
+struct PerftPosition {
+  /// The name used to refer to the position.
+  std::string_view name;
+  /// Builds a board in the position, with White to move.
+  Board (*build)();
+  /// The known leaf counts, where the first element corresponds to depth 1.
+  std::vector<std::uint64_t> expectedNodes;
+};
+
+/**
+  Returns the starting position and a set of tricky positions (castling,
+  en passant, promotions and pins), together with their known leaf counts.
+*/
+std::vector<PerftPosition> const& standardPerftPositions();
+
+}
+
+#endif // CHESS_PERFT
@@ -4,28 +4,19 @@
 
 namespace Chess {
 
-Piece::Piece(Colour colour, AbstractBoard& board): m_colour(colour), 
-                                                    m_board(board) {}
+Piece::Piece(Colour colour): m_colour(colour) {}
 
 Colour Piece::getColour() const {
   return m_colour;
 }
 
-void Piece::setBoard(AbstractBoard& board) noexcept {
-  m_board = board;
-}
-
-AbstractBoard const& Piece::getBoard() const {
-  return m_board.get();
-}
-
 std::ostream& operator<<(std::ostream& out, const Piece& piece) {
   std::string owner = (piece.m_colour == Colour::White)? "White" : "Black";
   return out << (owner + "'s " + piece.name());
 }
 
-bool Piece::isNormalMove(Coordinates const& source,
-                            Coordinates const& destination) const {
+bool Piece::isNormalMove(AbstractBoard const& board, Coordinates const& source,
+                         Coordinates const& destination) const {
   if (!AbstractBoard::areWithinLimits(source) || !AbstractBoard::areWithinLimits(destination)) {
     return false;
   }
@@ -34,17 +25,17 @@ bool Piece::isNormalMove(Coordinates const& source,
     return false;
   }
 
-  auto target = getBoard().at(destination);
+  auto target = board.at(destination);
   if (target && target->getColour() == getColour()) {
     return false;
   }
 
-  auto thisPiece = getBoard().at(source);
+  auto thisPiece = board.at(source);
   if (!thisPiece || thisPiece != this) {
     return false;
   }
 
-  return isNormalMoveSpecific(source, destination);
+  return isNormalMoveSpecific(board, source, destination);
 }
 
 void Piece::setMovedStatus(bool moved) {
@@ -55,8 +46,4 @@ bool Piece::getMovedStatus() const {
   return m_moved;
 }
 
-AbstractBoard& Piece::getMutableBoard() {
-  return m_board.get();
-}
-
 }
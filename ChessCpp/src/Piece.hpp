@@ -11,26 +11,28 @@ class AbstractBoard;
 /// Represents a generic piece.
 class Piece {
 public:
-  /// Creates a chess piece of the given colour and associated with a board.
-  Piece(Colour colour, AbstractBoard& board);
+  /// Creates a chess piece of the given colour.
+  explicit Piece(Colour colour);
 
   /**
    Returns whether moving from the source to the destination provided is a 
-   normal move according to the piece logic and patterns. Castling and checks
-   are considered responsibilities of the board, and are ignored.
+   normal move on the given board according to the piece logic and patterns.
+   Castling and checks are considered responsibilities of the board, and are
+   ignored.
   
    Returns false if certain conditions common to all pieces are not satisfied.
    For example:
    coordinates must be within the board limits, a piece cannot move to a square
-   taken by an ally, and source and destination cannot match.
+   taken by an ally, source and destination cannot match, and the piece must
+   be at the source on the board.
 
    In all other cases, it returns the derived class' isNormalMoveSpecific().
   */
-  bool isNormalMove(Coordinates const& source,
-                       Coordinates const& destination) const;
+  bool isNormalMove(AbstractBoard const& board, Coordinates const& source,
+                    Coordinates const& destination) const;
 
   //! @copydoc AbstractBoard::move(Pawn&,Coordinates const&,Coordinates const&)
-  virtual MoveResult move(Coordinates const& source, 
+  virtual MoveResult move(AbstractBoard& board, Coordinates const& source,
                           Coordinates const& destination) = 0;
 
   /// Flags the piece to mean it has moved before.
@@ -42,18 +44,12 @@ public:
   /// Returns the colour of the piece.
   Colour getColour() const;
 
-  /**
-   Performs one-sided assignment of the given board to this piece.
-   In other words, the piece will act assuming it is contained in the board.
-  */
-  void setBoard(AbstractBoard& board) noexcept;
-
-  /// Returns the board currently associated with this piece.
-  AbstractBoard const& getBoard() const;
-
   /// Returns the name of the piece (e.g. "Rook").
   virtual std::string name() const = 0;
 
+  /// Returns the type of the piece.
+  virtual PieceType type() const = 0;
+
   /**
    Prints the colour (owner) and the piece name as "Colour's PieceName".
    It requires name() to be overriden to return a piece name.
@@ -62,27 +58,28 @@ public:
 
   virtual ~Piece() = default;
 
-  Piece& operator=(Piece const&) = delete;
-  Piece& operator=(Piece&&) = delete;
-
 protected:
-  /// Returns the non-const board currently associated with this piece.
-  AbstractBoard& getMutableBoard();
+  // pieces are values which boards store in place, but assigning through a
+  // reference to the base would slice them
+  Piece(Piece const&) = default;
+  Piece(Piece&&) = default;
+  Piece& operator=(Piece const&) = default;
+  Piece& operator=(Piece&&) = default;
 
 private:
-  /// Checks if a piece can move according to its specific patterns.
-  virtual bool isNormalMoveSpecific(Coordinates const& source,
-                               Coordinates const& destination) const = 0;
+  /// Checks if a piece can move on the board according to its specific patterns.
+  virtual bool isNormalMoveSpecific(AbstractBoard const& board,
+                                    Coordinates const& source,
+                                    Coordinates const& destination) const = 0;
 
   Colour m_colour;
   bool m_moved = false;
-  std::reference_wrapper<AbstractBoard> m_board;
 };
 
 /// Represents a piece that can be used to promote a pawn.
 class PromotionPiece: public Piece {
 public:
-  PromotionPiece(Colour colour, AbstractBoard& board): Piece(colour, board) {};
+  explicit PromotionPiece(Colour colour): Piece(colour) {};
 };
 
 }
@@ -0,0 +1,386 @@
+#include "Attacks.hpp"
+#include <cstdlib>
+#include "Position.hpp"
+#include <stdexcept>
+#include "Zobrist.hpp"
+
+/// Defines the number of plies after which the game ends in a draw.
+int constexpr SEVENTYFIVE_MOVES_PLIES = 150;
+
+namespace Chess {
+
+/// Returns the square the king of the given colour starts from.
+template <Colour colour>
+constexpr int kingStartSquare() {
+  return toSquare(Coordinates(4, relativeRow<colour>(0)));
+}
+
+/// Returns the row where pawns of the given colour are promoted.
+template <Colour colour>
+constexpr int promotionRow() {
+  return relativeRow<colour>(BOARD_SIDE - 1);
+}
+
+/// Returns the piece type a pawn turns into with the given promotion.
+PieceType promotedType(PromotionOption option) {
+  switch (option) {
+  case PromotionOption::Knight: return PieceType::Knight;
+  case PromotionOption::Bishop: return PieceType::Bishop;
+  case PromotionOption::Rook: return PieceType::Rook;
+  case PromotionOption::Queen: return PieceType::Queen;
+  default:
+    throw std::logic_error("Promotion not correctly implemented");
+  }
+}
+
+/**
+  Lists a pawn move once per promotion option if it reaches the last row,
+  or as a normal move otherwise.
+*/
+template <Colour colour>
+void addPawnMove(MoveList& moves, int source, int destination) {
+  auto sourceCoord = toCoordinates(source);
+  auto destinationCoord = toCoordinates(destination);
+  if (destinationCoord.row == promotionRow<colour>()) {
+    for (auto option : {PromotionOption::Queen, PromotionOption::Rook,
+                        PromotionOption::Bishop, PromotionOption::Knight}) {
+      moves.emplace_back(sourceCoord, destinationCoord, option);
+    }
+  } else {
+    moves.emplace_back(sourceCoord, destinationCoord);
+  }
+}
+
+std::optional<PieceType> Position::typeAt(int square) const {
+  auto mask = squareMask(square);
+  for (size_t type = 0; type < pieces.size(); ++type) {
+    if (pieces[type] & mask) {
+      return static_cast<PieceType>(type);
+    }
+  }
+  return std::nullopt;
+}
+
+std::optional<Colour> Position::colourAt(int square) const {
+  auto mask = squareMask(square);
+  if (colours[static_cast<size_t>(Colour::White)] & mask) {
+    return Colour::White;
+  }
+  if (colours[static_cast<size_t>(Colour::Black)] & mask) {
+    return Colour::Black;
+  }
+  return std::nullopt;
+}
+
+/**
+  Returns the pieces of the given colour attacking the square, as described
+  in Position::attackersTo, with the colour known at compile time.
+*/
+template <Colour attacker>
+Bitboard attackersTo(Position const& position, int square, Bitboard occupied) {
+  auto queens = position.piecesOf(attacker, PieceType::Queen);
+  // a piece attacks the square if, moving like it, the square reaches it
+  return (knightAttacks(square) &
+                              position.piecesOf(attacker, PieceType::Knight)) |
+         (kingAttacks(square) & position.piecesOf(attacker, PieceType::King)) |
+         (pawnAttacks<opponentOf(attacker)>(square) &
+                                position.piecesOf(attacker, PieceType::Pawn)) |
+         (bishopAttacks(square, occupied) &
+                    (position.piecesOf(attacker, PieceType::Bishop) | queens)) |
+         (rookAttacks(square, occupied) &
+                    (position.piecesOf(attacker, PieceType::Rook) | queens));
+}
+
+Bitboard Position::attackersTo(int square, Colour attacker,
+                               Bitboard occupied) const {
+  return attacker == Colour::White ?
+         Chess::attackersTo<Colour::White>(*this, square, occupied) :
+         Chess::attackersTo<Colour::Black>(*this, square, occupied);
+}
+
+bool Position::isInCheck() const {
+  auto king = piecesOf(sideToMove, PieceType::King);
+  return king != 0 &&
+         attackersTo(lowestSquare(king), opponentOf(sideToMove), occupied()) != 0;
+}
+
+bool Position::sufficientMaterial() const {
+  // a king with at most a knight or a bishop cannot checkmate
+  return popCount(colours[0]) > 2 || popCount(colours[1]) > 2 ||
+         (pieces[static_cast<size_t>(PieceType::Pawn)] |
+          pieces[static_cast<size_t>(PieceType::Rook)] |
+          pieces[static_cast<size_t>(PieceType::Queen)]) != 0;
+}
+
+/**
+  Fills the list with the legal moves of the given colour, which must be the
+  one to move, as described in Position::generateLegalMoves. Directions and
+  rows are known at compile time, so the side to move is tested once.
+*/
+template <Colour us>
+void generateLegalMoves(Position const& position, MoveList& moves) {
+  auto constexpr enemy = opponentOf(us);
+  auto own = position.colours[static_cast<size_t>(us)];
+  auto enemies = position.colours[static_cast<size_t>(enemy)];
+  auto all = position.occupied();
+  auto king = lowestSquare(position.piecesOf(us, PieceType::King));
+  auto kingCoord = toCoordinates(king);
+
+  // the king must not step onto a square attacked once it has left its own
+  auto targets = kingAttacks(king) & ~own;
+  while (targets) {
+    auto destination = popLowestSquare(targets);
+    if (attackersTo<enemy>(position, destination,
+                           all & ~squareMask(king)) == 0) {
+      moves.emplace_back(kingCoord, toCoordinates(destination));
+    }
+  }
+
+  // a single check is stopped by capturing or blocking, a double one is not
+  auto checkers = attackersTo<enemy>(position, king, all);
+  if (popCount(checkers) > 1) {
+    return;
+  }
+  auto evasions = checkers == 0 ? ~Bitboard(0) :
+                                  checkers | between(king, lowestSquare(checkers));
+
+  // an enemy slider aiming at the king through exactly one of our pieces pins it
+  auto queens = position.piecesOf(enemy, PieceType::Queen);
+  auto snipers =
+    (rookAttacks(king, 0) &
+                      (position.piecesOf(enemy, PieceType::Rook) | queens)) |
+    (bishopAttacks(king, 0) &
+                      (position.piecesOf(enemy, PieceType::Bishop) | queens));
+  Bitboard pinned = 0;
+  while (snipers) {
+    auto blockers = between(king, popLowestSquare(snipers)) & all;
+    if (popCount(blockers) == 1 && (blockers & own)) {
+      pinned |= blockers;
+    }
+  }
+  auto allowed = [&](int source) {
+    return (pinned & squareMask(source)) ? evasions & line(king, source) :
+                                           evasions;
+  };
+
+  if (checkers == 0 && (position.unmoved & squareMask(king)) &&
+      king == kingStartSquare<us>()) {
+    for (auto dir : {1, -1}) {
+      auto rook = king + (dir == 1 ? 3 : -4);
+      auto path = {king + dir, king + 2 * dir};
+      bool canCastle = (position.unmoved &
+                        position.piecesOf(us, PieceType::Rook) &
+                        squareMask(rook)) &&
+                       (between(king, rook) & all) == 0;
+      for (auto square : path) {
+        canCastle = canCastle &&
+                    attackersTo<enemy>(position, square, all) == 0;
+      }
+      if (canCastle) {
+        moves.emplace_back(kingCoord, toCoordinates(king + 2 * dir),
+                           Move::Kind::Castling);
+      }
+    }
+  }
+
+  for (auto type : {PieceType::Knight, PieceType::Bishop, PieceType::Rook,
+                    PieceType::Queen}) {
+    auto sources = position.piecesOf(us, type);
+    while (sources) {
+      auto source = popLowestSquare(sources);
+      Bitboard attacks = 0;
+      if (type == PieceType::Knight) {
+        attacks = knightAttacks(source);
+      }
+      if (type == PieceType::Bishop || type == PieceType::Queen) {
+        attacks |= bishopAttacks(source, all);
+      }
+      if (type == PieceType::Rook || type == PieceType::Queen) {
+        attacks |= rookAttacks(source, all);
+      }
+      targets = attacks & ~own & allowed(source);
+      while (targets) {
+        moves.emplace_back(toCoordinates(source),
+                           toCoordinates(popLowestSquare(targets)));
+      }
+    }
+  }
+
+  auto pawns = position.piecesOf(us, PieceType::Pawn);
+  auto sources = pawns;
+  while (sources) {
+    auto source = popLowestSquare(sources);
+    targets = pawnAttacks<us>(source) & enemies & allowed(source);
+    while (targets) {
+      addPawnMove<us>(moves, source, popLowestSquare(targets));
+    }
+  }
+
+  // the pushes of every pawn are found at once, then traced back to the pawn
+  auto singleSteps = pushed<us>(pawns) & ~all;
+  auto doubleSteps = pushed<us>(singleSteps & rowMask(relativeRow<us>(2))) &
+                     ~all;
+  while (singleSteps) {
+    auto destination = popLowestSquare(singleSteps);
+    auto source = destination - FORWARD<us>;
+    if (allowed(source) & squareMask(destination)) {
+      addPawnMove<us>(moves, source, destination);
+    }
+  }
+  while (doubleSteps) {
+    auto destination = popLowestSquare(doubleSteps);
+    auto source = destination - 2 * FORWARD<us>;
+    if (allowed(source) & squareMask(destination)) {
+      moves.emplace_back(toCoordinates(source), toCoordinates(destination));
+    }
+  }
+
+  if (position.enPassantFile != Position::NO_EN_PASSANT) {
+    auto captured = toSquare(Coordinates(position.enPassantFile,
+                                         relativeRow<us>(4)));
+    auto destination = captured + FORWARD<us>;
+    auto capturedMask = squareMask(captured);
+    auto capturers = pawnAttacks<enemy>(destination) & pawns;
+    while (capturers) {
+      // en passant empties two squares of the same row, so the pins cannot tell
+      auto source = popLowestSquare(capturers);
+      auto afterCapture = (all & ~squareMask(source) & ~capturedMask) |
+                          squareMask(destination);
+      if ((attackersTo<enemy>(position, king, afterCapture) &
+                                                      ~capturedMask) == 0) {
+        moves.emplace_back(toCoordinates(source), toCoordinates(destination),
+                           Move::Kind::EnPassant);
+      }
+    }
+  }
+}
+
+void Position::generateLegalMoves(MoveList& moves) const {
+  moves.clear();
+  if (countSincePawnMoveOrCapture >= SEVENTYFIVE_MOVES_PLIES ||
+      !sufficientMaterial()) {
+    return;
+  }
+
+  if (sideToMove == Colour::White) {
+    Chess::generateLegalMoves<Colour::White>(*this, moves);
+  } else {
+    Chess::generateLegalMoves<Colour::Black>(*this, moves);
+  }
+}
+
+void Position::play(Move const& move) {
+  auto us = sideToMove;
+  auto enemy = opponentOf(us);
+  auto source = toSquare(move.source());
+  auto destination = toSquare(move.destination());
+  auto destinationMask = squareMask(destination);
+  auto type = *typeAt(source);
+
+  auto remove = [this](Colour colour, PieceType pieceType, int square) {
+    auto mask = squareMask(square);
+    key ^= ZobristHasher::pieceKey(colour, pieceType, (unmoved & mask) == 0,
+                                   square);
+    pieces[static_cast<size_t>(pieceType)] &= ~mask;
+    colours[static_cast<size_t>(colour)] &= ~mask;
+    unmoved &= ~mask;
+  };
+  auto place = [this](Colour colour, PieceType pieceType, int square,
+                      bool moved) {
+    auto mask = squareMask(square);
+    key ^= ZobristHasher::pieceKey(colour, pieceType, moved, square);
+    pieces[static_cast<size_t>(pieceType)] |= mask;
+    colours[static_cast<size_t>(colour)] |= mask;
+    if (!moved) {
+      unmoved |= mask;
+    }
+  };
+
+  // regardless of the move, the right to en passant is gone
+  if (enPassantFile != NO_EN_PASSANT) {
+    key ^= ZobristHasher::enPassantKey(enPassantFile);
+    enPassantFile = NO_EN_PASSANT;
+  }
+  ++countSincePawnMoveOrCapture;
+
+  auto captured = destination;
+  if (type == PieceType::Pawn && (occupied() & destinationMask) == 0 &&
+      move.source().column != move.destination().column) {
+    captured = toSquare(Coordinates(move.destination().column,
+                                    move.source().row));
+  }
+  if (colours[static_cast<size_t>(enemy)] & squareMask(captured)) {
+    remove(enemy, *typeAt(captured), captured);
+    countSincePawnMoveOrCapture = 0;
+  }
+
+  remove(us, type, source);
+  if (auto promotion = move.promotion()) {
+    // promoted pieces count as unmoved, as they do for the board and hasher
+    place(us, promotedType(*promotion), destination, false);
+  } else {
+    place(us, type, destination, true);
+  }
+
+  if (type == PieceType::Pawn) {
+    countSincePawnMoveOrCapture = 0;
+    auto column = move.destination().column;
+    Bitboard sides = 0;
+    if (column > 0) {
+      sides |= squareMask(destination - 1);
+    }
+    if (column < BOARD_SIDE - 1) {
+      sides |= squareMask(destination + 1);
+    }
+    if (abs(destination - source) == 2 * BOARD_SIDE &&
+        (sides & piecesOf(enemy, PieceType::Pawn))) {
+      enPassantFile = static_cast<std::int8_t>(column);
+      key ^= ZobristHasher::enPassantKey(column);
+    }
+  } else if (type == PieceType::King && abs(destination - source) == 2) {
+    auto kingSide = destination > source;
+    auto rookSource = kingSide ? source + 3 : source - 4;
+    auto rookDestination = kingSide ? source + 1 : source - 1;
+    remove(us, PieceType::Rook, rookSource);
+    place(us, PieceType::Rook, rookDestination, true);
+  }
+
+  sideToMove = enemy;
+  key ^= ZobristHasher::playerKey();
+}
+
+BoardHash Position::computeKey() const {
+  BoardHash result = 0;
+  for (auto colour : {Colour::White, Colour::Black}) {
+    for (size_t type = 0; type < pieces.size(); ++type) {
+      auto squares = piecesOf(colour, static_cast<PieceType>(type));
+      while (squares) {
+        auto square = popLowestSquare(squares);
+        result ^= ZobristHasher::pieceKey(colour, static_cast<PieceType>(type),
+                                        (unmoved & squareMask(square)) == 0,
+                                        square);
+      }
+    }
+  }
+  if (enPassantFile != NO_EN_PASSANT) {
+    result ^= ZobristHasher::enPassantKey(enPassantFile);
+  }
+  if (sideToMove == Colour::Black) {
+    result ^= ZobristHasher::playerKey();
+  }
+  return result;
+}
+
+bool Position::operator== (Position const& other) const {
+  return pieces == other.pieces && colours == other.colours &&
+         unmoved == other.unmoved && key == other.key &&
+         countSincePawnMoveOrCapture == other.countSincePawnMoveOrCapture &&
+         enPassantFile == other.enPassantFile &&
+         sideToMove == other.sideToMove;
+}
+
+bool Position::operator!= (Position const& other) const {
+  return !operator==(other);
+}
+
+}
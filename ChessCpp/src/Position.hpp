@@ -0,0 +1,114 @@
+#ifndef CHESS_POSITION
+#define CHESS_POSITION
+
+#include <array>
+#include "Bitboard.hpp"
+#include "BoardHasher.hpp"
+#include <cstdint>
+#include "Move.hpp"
+#include <optional>
+#include <type_traits>
+#include "Utils.hpp"
+
+namespace Chess {
+
+/**
+  Represents the state of a game relevant to the rules: where the pieces are,
+  which of them never moved (granting castling), the player to move, the
+  right to capture en passant, the count of plies since the last pawn move or
+  capture and the hash key. Pawns may double step from their starting row
+  only, where they never moved.
+
+  A position holds no pointers and is trivially copyable, so it can be cloned
+  with memcpy (e.g. for a worker thread) and moves can be applied to a copy
+  rather than undone. Unlike Board, it keeps no history, so draws by
+  repetition are not detected.
+*/
+struct Position {
+  /// Defines the value of enPassantFile when no capture en passant is allowed.
+  static std::int8_t constexpr NO_EN_PASSANT = -1;
+
+  /// The pieces of both colours, one bitboard per piece type.
+  std::array<Bitboard, static_cast<int>(PieceType::King) + 1> pieces{};
+  /// The pieces of each colour, indexed by colour.
+  std::array<Bitboard, 2> colours{};
+  /**
+    The pieces which never moved. Only kings and rooks rely on it, pawns being
+    unmoved exactly on their starting row.
+  */
+  Bitboard unmoved = 0;
+  /// The hash of the position, equal to the one of a Zobrist hasher.
+  BoardHash key = 0;
+  /// The number of plies since a pawn moved or a piece was captured.
+  std::uint16_t countSincePawnMoveOrCapture = 0;
+  /**
+    The column of the pawn which just made a double step, if an enemy pawn
+    stands next to it. Set to NO_EN_PASSANT otherwise.
+  */
+  std::int8_t enPassantFile = NO_EN_PASSANT;
+  /// The player to move.
+  Colour sideToMove = Colour::White;
+
+  /// Returns the squares holding any piece.
+  Bitboard occupied() const {
+    return colours[0] | colours[1];
+  }
+
+  /// Returns the pieces of the given colour and type.
+  Bitboard piecesOf(Colour colour, PieceType type) const {
+    return pieces[static_cast<size_t>(type)] &
+           colours[static_cast<size_t>(colour)];
+  }
+
+  /// Returns the type of the piece on the square, or an empty optional.
+  std::optional<PieceType> typeAt(int square) const;
+
+  /// Returns the colour of the piece on the square, or an empty optional.
+  std::optional<Colour> colourAt(int square) const;
+
+  /**
+    Returns the pieces of the given colour attacking the square, as if the
+    squares occupied were the ones given.
+  */
+  Bitboard attackersTo(int square, Colour attacker, Bitboard occupied) const;
+
+  /// Returns true if the player to move is in check, false otherwise.
+  bool isInCheck() const;
+
+  /**
+    Returns false if neither player has enough pieces left to checkmate,
+    following the same rule as Board.
+  */
+  bool sufficientMaterial() const;
+
+  /**
+    Fills the list given with every legal move of the player to move, replacing
+    its previous content, as described in Board::generateLegalMoves.
+    The list is left empty if the game is over by checkmate, stalemate,
+    insufficient material or the 75-move rule.
+  */
+  void generateLegalMoves(MoveList& moves) const;
+
+  /**
+    Plays a legal move, updating the key incrementally. A pawn reaching the
+    last row must carry its promotion. Playing an illegal move leaves the
+    position in an unspecified state.
+  */
+  void play(Move const& move);
+
+  /// Computes the key of the position from scratch.
+  BoardHash computeKey() const;
+
+  /// Returns true if every member is identical, false otherwise.
+  bool operator== (Position const& other) const;
+  /// Returns true if any member is different, false otherwise.
+  bool operator!= (Position const& other) const;
+};
+
+static_assert(std::is_trivially_copyable_v<Position>,
+              "Positions must be copyable with memcpy");
+static_assert(sizeof(Position) < 200, "Positions must be cheap to copy");
+
+}
+
+#endif // CHESS_POSITION
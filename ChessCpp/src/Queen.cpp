@@ -3,32 +3,36 @@
 
 namespace Chess {
 
-Queen::Queen(Colour colour, AbstractBoard& board):
-                                                PromotionPiece(colour, board) {}
+Queen::Queen(Colour colour): PromotionPiece(colour) {}
 
 std::string Queen::name() const {
   return "Queen";
 }
 
-bool Queen::isNormalMoveSpecific(Coordinates const& source,
-                               Coordinates const& destination) const {
+PieceType Queen::type() const {
+  return PieceType::Queen;
+}
+
+bool Queen::isNormalMoveSpecific(AbstractBoard const& board,
+                                 Coordinates const& source,
+                                 Coordinates const& destination) const {
   if (source.sameRowAs(destination)) {
-    return getBoard().isFreeRow(source, destination.column);
+    return board.isFreeRow(source, destination.column);
   }
 
   if (source.sameColumnAs(destination)) {
-    return getBoard().isFreeColumn(source, destination.row);
+    return board.isFreeColumn(source, destination.row);
   }
 
   if (source.sameDiagonalAs(destination)) {
-    return getBoard().isFreeDiagonal(source, destination);
+    return board.isFreeDiagonal(source, destination);
   }
   return false;
 }
 
-MoveResult Queen::move(Coordinates const& source, 
+MoveResult Queen::move(AbstractBoard& board, Coordinates const& source,
                        Coordinates const& destination) {
-  return getMutableBoard().move(*this, source, destination);
+  return board.move(*this, source, destination);
 }
 
 }
@@ -14,23 +14,27 @@ public:
   /// Defines the standard starting position of the black queen on a board.
   static auto constexpr BLACK_STD_INIT = Coordinates(3, 7);
 
-  /// Constructs a queen of the given colour and associated to a board.
-  Queen(Colour colour, AbstractBoard& board);
+  /// Constructs a queen of the given colour.
+  Queen(Colour colour);
 
   //! @copydoc AbstractBoard::move(Pawn&,Coordinates const&,Coordinates const&)
-  MoveResult move(Coordinates const& source,
-                          Coordinates const& destination) override;
+  MoveResult move(AbstractBoard& board, Coordinates const& source,
+                  Coordinates const& destination) override;
 
   /// Returns "Queen".
   std::string name() const override;
 
+  /// Returns PieceType::Queen.
+  PieceType type() const override;
+
 private:
   /**
    Checks for queen-specific moves and returns true if the supplied move
    is valid in the associated board, false otherwise.
   */
-  bool isNormalMoveSpecific(Coordinates const& source,
-                           Coordinates const& destination) const override;
+  bool isNormalMoveSpecific(AbstractBoard const& board,
+                            Coordinates const& source,
+                            Coordinates const& destination) const override;
 };
 
 }
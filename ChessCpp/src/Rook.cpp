@@ -8,16 +8,16 @@ std::vector<Coordinates> const Rook::WHITE_STD_INIT =
 std::vector<Coordinates> const Rook::BLACK_STD_INIT = 
                                          {Coordinates(0, 7), Coordinates(7, 7)};
 
-Rook::Rook(Colour colour, AbstractBoard& board): 
-                                                PromotionPiece(colour, board) {}
+Rook::Rook(Colour colour): PromotionPiece(colour) {}
 
-bool Rook::isNormalMoveSpecific(Coordinates const& source,
-                                   Coordinates const& destination) const {
+bool Rook::isNormalMoveSpecific(AbstractBoard const& board,
+                                Coordinates const& source,
+                                Coordinates const& destination) const {
   if (source.sameRowAs(destination)) {
-      return getBoard().isFreeRow(source, destination.column);
+      return board.isFreeRow(source, destination.column);
   }
   else if (source.sameColumnAs(destination)) {
-      return getBoard().isFreeColumn(source, destination.row);
+      return board.isFreeColumn(source, destination.row);
   }
 
   return false;
@@ -27,8 +27,12 @@ std::string Rook::name() const {
   return "Rook";
 }
 
-MoveResult Rook::move(Coordinates const& source, 
+PieceType Rook::type() const {
+  return PieceType::Rook;
+}
+
+MoveResult Rook::move(AbstractBoard& board, Coordinates const& source,
                       Coordinates const& destination) {
-  return getMutableBoard().move(*this, source, destination);
+  return board.move(*this, source, destination);
 }
 }
@@ -20,23 +20,27 @@ public:
   */
   static std::vector<Coordinates> const BLACK_STD_INIT;
 
-  /// Constructs a rook of the given colour and associated to a board.
-  Rook(Colour colour, AbstractBoard& board);
+  /// Constructs a rook of the given colour.
+  Rook(Colour colour);
 
   //! @copydoc AbstractBoard::move(Pawn&,Coordinates const&,Coordinates const&)
-  MoveResult move(Coordinates const& source,
-                          Coordinates const& destination) override;
+  MoveResult move(AbstractBoard& board, Coordinates const& source,
+                  Coordinates const& destination) override;
 
   /// Returns "Rook".
   std::string name() const override;
 
+  /// Returns PieceType::Rook.
+  PieceType type() const override;
+
 private:
   /**
    Checks for rook-specific moves and returns true if the supplied move
    is valid in the associated board, false otherwise.
   */
-  bool isNormalMoveSpecific(Coordinates const& source,
-                           Coordinates const& destination) const override;
+  bool isNormalMoveSpecific(AbstractBoard const& board,
+                            Coordinates const& source,
+                            Coordinates const& destination) const override;
 };
 
 }
@@ -1,8 +1,15 @@
+#include <array>
 #include "Utils.hpp"
 #include "Piece.hpp"
 
 namespace Chess {
 
+std::string_view pieceTypeName(PieceType type) {
+  static std::array<std::string_view, 6> constexpr NAMES = {
+    "Pawn", "Knight", "Bishop", "Rook", "Queen", "King"};
+  return NAMES[static_cast<size_t>(type)];
+}
+
 bool Coordinates::operator== (Coordinates const& other) const {
   return column == other.column && row == other.row;
 }
@@ -23,10 +30,4 @@ bool Coordinates::sameDiagonalAs(Coordinates const& other) const {
   return abs(column - other.column) == abs(row - other.row);
 }
 
-std::size_t PieceRefHasher::operator()(
-                                std::reference_wrapper<Piece> const& p) const {
-  // use address of pointed Piece as hash
-  return reinterpret_cast<std::size_t>(&(p.get()));
-}
-
 }
@@ -3,6 +3,7 @@
 
 #include <functional>
 #include <optional>
+#include <string_view>
 #include <utility>
 
 namespace Chess {
@@ -12,6 +13,11 @@ class Piece;
 /// Defines the typical chess colours.
 enum class Colour:int { White = 0, Black };
 
+/// Returns the opponent of the given colour.
+constexpr Colour opponentOf(Colour colour) {
+  return colour == Colour::White ? Colour::Black : Colour::White;
+}
+
 /// Represents a pair of coordinates.
 struct Coordinates {
   int column = 0;
@@ -33,11 +39,6 @@ struct Coordinates {
   bool sameDiagonalAs(Coordinates const& other) const;
 };
 
-/// Performs hashing of a reference wrapper containing a Piece.
-struct PieceRefHasher {
-  std::size_t operator()(std::reference_wrapper<Piece> const& p) const;
-};
-
 /// Represents a piece another can be promoted into.
 enum class PromotionOption {
   Knight, Bishop, Rook, Queen
@@ -49,19 +50,12 @@ enum class CastlingType {
   QueenSide,
 };
 
-}
-
-namespace std {
+/// Defines the types of chess pieces.
+enum class PieceType:int { Pawn = 0, Knight, Bishop, Rook, Queen, King };
 
-// allow comparisons of std::reference_wrapper<Chess::Piece>, making
-// creation of unordered_map of Piece reference wrappers possible
-template<>
-struct equal_to<std::reference_wrapper<Chess::Piece>> {
-  bool operator()(std::reference_wrapper<Chess::Piece> const& lhs,
-                  std::reference_wrapper<Chess::Piece> const& rhs) const {
-    return &(lhs.get()) == &(rhs.get());
-  }
-};
+/// Returns the name of the piece type given (e.g. "Rook"), as Piece::name().
+std::string_view pieceTypeName(PieceType type);
 
 }
+
 #endif // CHESS_UTILS
\ No newline at end of file
@@ -1,5 +1,4 @@
 #include "Bishop.hpp"
-#include <ctime>
 #include <cstdlib>
 #include "King.hpp"
 #include "Knight.hpp"
@@ -9,9 +8,50 @@
 #include "Zobrist.hpp"
 
 namespace Chess {
+
+/// Defines the number of piece states the hasher tells apart.
+size_t constexpr PIECE_INDEXES_COUNT = 18;
+
+/// Contains the random bitstrings combined to obtain a hash.
+struct ZobristKeys {
+  std::array<std::array<BoardHash, PIECE_INDEXES_COUNT>,
+                                          AbstractBoard::AREA> pieces{};
+  std::array<BoardHash, AbstractBoard::MAX_COL_NUM + 1> enPassant{};
+  BoardHash whitePlayer = 0;
+};
+
+/**
+  Builds the keys with the splitmix64 algorithm. Its output is a bijection of
+  a counter, so the keys are all distinct and the same at every run.
+*/
+constexpr ZobristKeys buildZobristKeys() {
+  ZobristKeys keys;
+  BoardHash state = 0x2545F4914F6CDD1DULL;
+  auto next = [&state]() {
+    state += 0x9E3779B97F4A7C15ULL;
+    auto z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  };
+
+  for (size_t square = 0; square < keys.pieces.size(); ++square) {
+    for (size_t piece = 0; piece < keys.pieces[square].size(); ++piece) {
+      keys.pieces[square][piece] = next();
+    }
+  }
+  for (size_t column = 0; column < keys.enPassant.size(); ++column) {
+    keys.enPassant[column] = next();
+  }
+  keys.whitePlayer = next();
+  return keys;
+}
+
+/// The keys shared by every hasher, computed at compile time.
+ZobristKeys constexpr KEYS = buildZobristKeys();
 enum class ZobristHasher::PieceIndex : int {
-  WhitePawn = 0, WhitePawnMoved, WhitePawnCanEnPassant,
-  BlackPawn, BlackPawnMoved, BlackPawnCanEnPassant,
+  WhitePawn = 0, WhitePawnMoved,
+  BlackPawn, BlackPawnMoved,
   WhiteKing, WhiteKingMoved,
   BlackKing, BlackKingMoved,
   WhiteQueen,
@@ -24,33 +64,20 @@ enum class ZobristHasher::PieceIndex : int {
   BlackKnight
 };
 
+/**
+  Represents the hasher state overwritten by a change, so that undoing it only
+  needs to put a handful of values back.
+*/
 struct ZobristHasher::PastMove {
-  PastMove(ZobristHasher const& hasher,
-           int src1D, int dest1D, int removedContent = EMPTY):
-                    PastMove(hasher, src1D, dest1D, removedContent, dest1D) {}
-  PastMove(ZobristHasher const& hasher,
-           int src1D, int dest1D, int removedContent, int removedCoords):
-            source(src1D),
-            destination(dest1D),
-            removedCoords(removedCoords),
-            sourceContent(hasher.m_board[src1D]),
-            destinationContent(hasher.m_board[dest1D]),
-            removedContent(removedContent),
-            pawnsBeforeEnPassant(hasher.m_pawnsBeforeEnPassant), 
-            hashBeforeMove(hasher.m_currentHash) {}
-
-  int source = 0;
-  int destination = 0;
-  int removedCoords = 0;
-  int sourceContent = EMPTY;
-  int destinationContent = EMPTY;
-  int removedContent = EMPTY;
-  std::unordered_map<int, PieceIndex> pawnsBeforeEnPassant;
-  int hashBeforeMove = 0;
+  int source;
+  int destination;
+  int sourceContent;
+  int destinationContent;
+  int enPassantFile;
+  BoardHash hashBeforeMove;
 };
 
 ZobristHasher::ZobristHasher() {
-  initializeTableAndWhitePlayer();
   reset();
 }
 
@@ -66,17 +93,60 @@ ZobristHasher::ZobristHasher(std::vector<Coordinates> const& whitePawns,
         std::vector<Coordinates> const& blackBishops,
         std::vector<Coordinates> const& blackQueens,
         Coordinates const& blackKing) {
-  initializeTableAndWhitePlayer();
   initializePieces(whitePawns, whiteRooks, whiteKnights, whiteBishops,
                   whiteQueens, whiteKing, blackPawns, blackRooks, blackKnights,
                   blackBishops, blackQueens, blackKing);
   m_currentHash = computeHashFromBoard();
 }
 
+ZobristHasher::ZobristHasher(Position const& position) {
+  reset(position);
+}
+
+BoardHash ZobristHasher::pieceKey(Colour colour, PieceType type, bool moved,
+                                  int square) {
+  return KEYS.pieces[square][static_cast<int>(indexOf(colour, type, moved))];
+}
+
+BoardHash ZobristHasher::enPassantKey(int column) {
+  return KEYS.enPassant[column];
+}
+
+BoardHash ZobristHasher::playerKey() {
+  return KEYS.whitePlayer;
+}
+
 void ZobristHasher::reset() {
+  static ZobristHasher const start(Pawn::WHITE_STD_INIT, Rook::WHITE_STD_INIT,
+    Knight::WHITE_STD_INIT, Bishop::WHITE_STD_INIT, {Queen::WHITE_STD_INIT},
+    King::WHITE_STD_INIT, Pawn::BLACK_STD_INIT, Rook::BLACK_STD_INIT,
+    Knight::BLACK_STD_INIT, Bishop::BLACK_STD_INIT, {Queen::BLACK_STD_INIT},
+    King::BLACK_STD_INIT);
   m_movesHistory.clear();
-  standardInitBoard();
-  m_currentHash = computeHashFromBoard();
+  m_enPassantFile = EMPTY;
+  m_board = start.m_board;
+  m_currentHash = start.m_currentHash;
+}
+
+void ZobristHasher::reset(Position const& position) {
+  m_movesHistory.clear();
+  m_board.fill(EMPTY);
+  for (int type = 0; type < static_cast<int>(position.pieces.size()); ++type) {
+    for (auto colour : {Colour::White, Colour::Black}) {
+      auto squares = position.piecesOf(colour, static_cast<PieceType>(type));
+      while (squares) {
+        auto square = popLowestSquare(squares);
+        auto moved = (position.unmoved & squareMask(square)) == 0;
+        m_board[square] = static_cast<int>(
+                      indexOf(colour, static_cast<PieceType>(type), moved));
+      }
+    }
+  }
+
+  // the key already accounts for en passant and the player to move
+  m_currentHash = position.key;
+  m_enPassantFile = (position.enPassantFile == Position::NO_EN_PASSANT) ?
+                    EMPTY : position.enPassantFile;
 }
 
 void ZobristHasher::pieceMoved(Coordinates const& source,
@@ -86,46 +156,27 @@ void ZobristHasher::pieceMoved(Coordinates const& source,
      auto dest1D = to1D(destination);
      auto movedVersion = movedEquivalent(
                           static_cast<ZobristHasher::PieceIndex>(m_board[src1D]));
-     auto stateBeforeMove = PastMove(*this, src1D, dest1D);
+     record(src1D, dest1D);
 
-     // reset en passant piece to what it was before
      // regardless of the move, the right to en passant is gone
-     for (auto const& [coord, piece] : m_pawnsBeforeEnPassant) {
-       replace(coord, piece);
-     }
-     m_pawnsBeforeEnPassant.clear();
-
-     if (isEnPassantRow(destination.row)) {
-       auto left = Coordinates(destination.column-1, destination.row);
-       auto right = Coordinates(destination.column+1, destination.row);
-       std::vector<int> coords1D;
-       if (areWithinLimits(left)) coords1D.push_back(to1D(left));
-       if (areWithinLimits(right)) coords1D.push_back(to1D(right));
-
-       if (auto enemyPawnOpt = getEnemyMovedPawn(movedVersion)) {
-         for (auto const& coord1D : coords1D) {
-           if (m_board[coord1D] == static_cast<int>(*enemyPawnOpt)) {
-             m_pawnsBeforeEnPassant[coord1D] = *enemyPawnOpt;
-             replace(coord1D, *getEnPassantPawn(*enemyPawnOpt));
-           }
-         }
-       }
+     setEnPassantFile(EMPTY);
+     if (grantsEnPassant(source, destination, movedVersion)) {
+       setEnPassantFile(destination.column);
      }
      replace(dest1D, movedVersion);
      remove(src1D);
-     m_movesHistory.push_back(std::move(stateBeforeMove));
    }
 }
 
 void ZobristHasher::removed(Coordinates const& coords) {
   auto coords1D = to1D(coords);
   if (m_board[coords1D] != EMPTY) {
-    m_movesHistory.emplace_back(*this, coords1D, coords1D);
+    record(coords1D, coords1D);
     remove(coords1D);
   }
 }
 
-int ZobristHasher::hash() {
+BoardHash ZobristHasher::hash() {
   return m_currentHash;
 }
 
@@ -149,22 +200,8 @@ void ZobristHasher::replacedWithPromotion(Coordinates const& source,
     throw std::logic_error("Promotion not implemented correctly");
   }
   auto src1D = to1D(source);
-  auto stateBeforeMove = PastMove(*this, src1D, src1D);
+  record(src1D, src1D);
   replace(src1D, replacement);
-  m_movesHistory.push_back(std::move(stateBeforeMove));
-}
-
-void ZobristHasher::initializeTableAndWhitePlayer() {
-  auto seed = time(NULL);
-  srand(static_cast<unsigned int>(seed));
-  std::unordered_set<int> seen; // ensure unique random values
-  for (auto& inner : m_table) {
-    for (auto& bitstring : inner) {
-      do { bitstring = rand(); } while (seen.count(bitstring) > 0);
-      seen.insert(bitstring);
-    }
-  }
-  do { m_whitePlayerHash = rand(); } while (seen.count(m_whitePlayerHash) > 0);
 }
 
 template <typename Predicate>
@@ -182,23 +219,10 @@ void ZobristHasher::initializePieces(std::vector<Coordinates> const& coords,
                                   " pieces in the same coordinates");
     }
 
-    if (!isNormalStartingCoord(coord)) {
-     piece = movedEquivalent(piece);
-    }
-    m_board[coord1D] = static_cast<int>(piece);
-  }
-}
-
-void ZobristHasher::standardInitBoard() {
-  std::vector<Coordinates> whitePawns, blackPawns;
-  for (int i = 0; i <= AbstractBoard::MAX_COL_NUM; ++i) {
-    whitePawns.emplace_back(i, 1);
-    blackPawns.emplace_back(i, AbstractBoard::MAX_ROW_NUM - 1);
+    // only the pieces away from their starting coordinates have moved
+    auto index = isNormalStartingCoord(coord) ? piece : movedEquivalent(piece);
+    m_board[coord1D] = static_cast<int>(index);
   }
-  initializePieces(whitePawns, Rook::WHITE_STD_INIT, Knight::WHITE_STD_INIT,
-    Bishop::WHITE_STD_INIT, {Queen::WHITE_STD_INIT}, King::WHITE_STD_INIT,
-    blackPawns, Rook::BLACK_STD_INIT, Knight::BLACK_STD_INIT,
-    Bishop::BLACK_STD_INIT, {Queen::BLACK_STD_INIT}, King::BLACK_STD_INIT);
 }
 
 int ZobristHasher::to1D(Coordinates const& coords) {
@@ -213,39 +237,68 @@ bool ZobristHasher::areWithinLimits(Coordinates const& coords) {
     coords.row <= AbstractBoard::MAX_ROW_NUM && coords.row >= 0);
 }
 
-int ZobristHasher::computeHashFromBoard() {
-  int h = 0;
+BoardHash ZobristHasher::computeHashFromBoard() {
+  BoardHash h = 0;
   for (size_t i = 0; i < m_board.size(); ++i) {
     if (m_board[i] != EMPTY) {
-      h ^= m_table[i][m_board[i]];
+      h ^= KEYS.pieces[i][m_board[i]];
     }
   }
   return h;
 }
 
-bool ZobristHasher::isEnPassantRow(int row) {
-  return row == AbstractBoard::MAX_ROW_NUM - 3 || row == 3;
+bool ZobristHasher::grantsEnPassant(Coordinates const& source,
+                                    Coordinates const& destination,
+                                    PieceIndex moved) {
+  auto enemyPawn = getEnemyMovedPawn(moved);
+  if (!enemyPawn || abs(destination.row - source.row) != 2) {
+    return false;
+  }
+
+  for (auto column : {destination.column - 1, destination.column + 1}) {
+    auto side = Coordinates(column, destination.row);
+    if (areWithinLimits(side) &&
+        m_board[to1D(side)] == static_cast<int>(*enemyPawn)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ZobristHasher::setEnPassantFile(int column) {
+  if (m_enPassantFile != EMPTY) {
+    m_currentHash ^= KEYS.enPassant[m_enPassantFile];
+  }
+  m_enPassantFile = column;
+  if (m_enPassantFile != EMPTY) {
+    m_currentHash ^= KEYS.enPassant[m_enPassantFile];
+  }
+}
+
+void ZobristHasher::record(int src1D, int dest1D) {
+  m_movesHistory.push_back({src1D, dest1D, m_board[src1D], m_board[dest1D],
+                            m_enPassantFile, m_currentHash});
 }
 
 void ZobristHasher::replace(int coor1D, ZobristHasher::PieceIndex replacement) {
   if (m_board[coor1D] != EMPTY) {
-    m_currentHash ^= m_table[coor1D][m_board[coor1D]];
+    m_currentHash ^= KEYS.pieces[coor1D][m_board[coor1D]];
   }
 
   auto replacementIdx = static_cast<int>(replacement);
   m_board[coor1D] = replacementIdx;
-  m_currentHash ^= m_table[coor1D][replacementIdx];
+  m_currentHash ^= KEYS.pieces[coor1D][replacementIdx];
 }
 
 void ZobristHasher::remove(int coord1D) {
   if (m_board[coord1D] != EMPTY) {
-    m_currentHash ^= m_table[coord1D][m_board[coord1D]];
+    m_currentHash ^= KEYS.pieces[coord1D][m_board[coord1D]];
     m_board[coord1D] = EMPTY;
   }
 }
 
 void ZobristHasher::togglePlayer() {
-  m_currentHash ^= m_whitePlayerHash;
+  m_currentHash ^= KEYS.whitePlayer;
 }
 
 ZobristHasher::PieceIndex constexpr ZobristHasher::movedEquivalent(
@@ -271,25 +324,36 @@ ZobristHasher::PieceIndex constexpr ZobristHasher::movedEquivalent(
   }
 }
 
-std::optional<ZobristHasher::PieceIndex>
-    ZobristHasher::getEnemyMovedPawn(ZobristHasher::PieceIndex pawn) {
-    switch(pawn) {
-    case PieceIndex::WhitePawnMoved:
-      return PieceIndex::BlackPawnMoved;
-    case PieceIndex::BlackPawnMoved:
-      return PieceIndex::WhitePawnMoved;
-    default:
-      return std::nullopt;
+ZobristHasher::PieceIndex ZobristHasher::indexOf(Colour colour,
+                                                 PieceType type, bool moved) {
+  bool white = colour == Colour::White;
+  PieceIndex index;
+  switch (type) {
+  case PieceType::Pawn:
+    index = white ? PieceIndex::WhitePawn : PieceIndex::BlackPawn; break;
+  case PieceType::Knight:
+    index = white ? PieceIndex::WhiteKnight : PieceIndex::BlackKnight; break;
+  case PieceType::Bishop:
+    index = white ? PieceIndex::WhiteBishop : PieceIndex::BlackBishop; break;
+  case PieceType::Rook:
+    index = white ? PieceIndex::WhiteRook : PieceIndex::BlackRook; break;
+  case PieceType::Queen:
+    index = white ? PieceIndex::WhiteQueen : PieceIndex::BlackQueen; break;
+  case PieceType::King:
+    index = white ? PieceIndex::WhiteKing : PieceIndex::BlackKing; break;
+  default:
+    throw std::logic_error("Piece type not implemented correctly");
   }
+  return moved ? movedEquivalent(index) : index;
 }
 
 std::optional<ZobristHasher::PieceIndex>
-     ZobristHasher::getEnPassantPawn(ZobristHasher::PieceIndex pawn) {
+    ZobristHasher::getEnemyMovedPawn(ZobristHasher::PieceIndex pawn) {
     switch(pawn) {
     case PieceIndex::WhitePawnMoved:
-      return PieceIndex::WhitePawnCanEnPassant;
+      return PieceIndex::BlackPawnMoved;
     case PieceIndex::BlackPawnMoved:
-      return PieceIndex::BlackPawnCanEnPassant;
+      return PieceIndex::WhitePawnMoved;
     default:
       return std::nullopt;
   }
@@ -352,25 +416,11 @@ void ZobristHasher::initializePieces(std::vector<Coordinates> const& whitePawns,
 
 void ZobristHasher::restorePreviousHash() {
   if (!m_movesHistory.empty()) {
-    auto& lastMove = m_movesHistory.back();
-    auto piece = static_cast<PieceIndex>(lastMove.sourceContent);
-    replace(lastMove.source, piece);
-
-    if (lastMove.destinationContent == EMPTY) {
-      remove(lastMove.destination);
-    } else {
-      replace(lastMove.destination,
-              static_cast<PieceIndex>(lastMove.destinationContent));
-    }
-
-    m_pawnsBeforeEnPassant = lastMove.pawnsBeforeEnPassant;
-    for (auto const& [coord, pawn] : lastMove.pawnsBeforeEnPassant) {
-      if (auto pawnEnPassant = getEnPassantPawn(pawn)) {
-        replace(coord, *pawnEnPassant);
-      }
-    }
+    auto const& lastMove = m_movesHistory.back();
+    m_board[lastMove.source] = lastMove.sourceContent;
+    m_board[lastMove.destination] = lastMove.destinationContent;
+    m_enPassantFile = lastMove.enPassantFile;
     m_currentHash = lastMove.hashBeforeMove;
-    
     m_movesHistory.pop_back();
   }
 }
@@ -4,7 +4,7 @@
 #include <array>
 #include "BoardHasher.hpp"
 #include "AbstractBoard.hpp"
-#include <unordered_set>
+#include "Position.hpp"
 #include <vector>
 
 namespace Chess {
@@ -14,7 +14,7 @@ class ZobristHasher final: public BoardHasher {
 public:
   /*
    Constructs a hasher for a chessboard, considering all pieces to be in their
-   standard starting positions.
+   standard starting positions. The state is copied from one computed once.
   */
   ZobristHasher();
 
@@ -44,12 +44,32 @@ public:
       std::vector<Coordinates> const& blackQueens,
       Coordinates const& blackKing);
 
+  /**
+   Constructs a hasher for the given position, including whether each piece
+   moved, the right to capture en passant and the player to move.
+   The key of the position is taken as the hash.
+  */
+  explicit ZobristHasher(Position const& position);
+
+  /**
+   Returns the key of a piece of the given colour and type on the square.
+   Only pawns, kings and rooks have a different key once they moved.
+  */
+  static BoardHash pieceKey(Colour colour, PieceType type, bool moved,
+                            int square);
+
+  /// Returns the key of the right to capture en passant in the given column.
+  static BoardHash enPassantKey(int column);
+
+  /// Returns the key toggled whenever the player to move changes.
+  static BoardHash playerKey();
+
   //! @copydoc BoardHasher::pieceMoved(Coordinates const&,Coordinates const&)
   void pieceMoved(Coordinates const& source,
                   Coordinates const& destination) override;
 
   //! @copydoc BoardHasher::hash()
-  int hash() override;
+  BoardHash hash() override;
 
   //! @copydoc BoardHasher::restorePreviousHash()
   void restorePreviousHash() override;
@@ -62,35 +82,41 @@ public:
                              PromotionOption prom,
                              Colour colour) override;
 
-  //! @copydoc BoardHasher::reset()
+  /**
+   Resets the hasher to the standard starting position, copying in a state
+   computed once rather than computing the hash again.
+  */
   void reset() override;
 
+  //! @copydoc BoardHasher::reset(Position const&)
+  void reset(Position const& position) override;
+
   //! @copydoc BoardHasher::togglePlayer()
   void togglePlayer() override;
 
   virtual ~ZobristHasher();
 
 private:
-  static size_t constexpr PIECE_INDEXES_COUNT = 20;
   static int constexpr EMPTY = -1;
   enum class PieceIndex;
   struct PastMove;
 
-  void initializeTableAndWhitePlayer();
   template <typename Predicate>
   void initializePieces(std::vector<Coordinates> const& coords, PieceIndex piece,
                         Predicate&& isNormalStartingCoord);
-  void standardInitBoard();
-  int computeHashFromBoard();
+  BoardHash computeHashFromBoard();
   int to1D(Coordinates const& coords);
   bool areWithinLimits(Coordinates const& coords);
-  bool isEnPassantRow(int row);
+  bool grantsEnPassant(Coordinates const& source,
+                       Coordinates const& destination, PieceIndex moved);
   void replace(int coord1D, PieceIndex replacement);
   void remove(int coord1D);
+  void setEnPassantFile(int column);
+  void record(int src1D, int dest1D);
 
-  PieceIndex constexpr movedEquivalent(PieceIndex idx);
+  static PieceIndex constexpr movedEquivalent(PieceIndex idx);
+  static PieceIndex indexOf(Colour colour, PieceType type, bool moved);
   std::optional<PieceIndex> getEnemyMovedPawn(PieceIndex pawn);
-  std::optional<PieceIndex> getEnPassantPawn(PieceIndex pawn);
 
   void initializePieces(std::vector<Coordinates> const& whitePawns,
       std::vector<Coordinates> const& whiteRooks,
@@ -105,11 +131,10 @@ private:
       std::vector<Coordinates> const& blackQueens,
       Coordinates const& blackKing);
 
-  std::array<std::array<int, PIECE_INDEXES_COUNT>, AbstractBoard::AREA> m_table;
   std::array<int, AbstractBoard::AREA> m_board;
-  int m_currentHash = 0;
-  int m_whitePlayerHash;
-  std::unordered_map<int, PieceIndex> m_pawnsBeforeEnPassant;
+  BoardHash m_currentHash = 0;
+  // column of the pawn which can be captured en passant, or EMPTY if none
+  int m_enPassantFile = EMPTY;
   std::vector<PastMove> m_movesHistory;
 };
 
@@ -0,0 +1,149 @@
+#include "pch.h"
+#include "Attacks.hpp"
+#include <random>
+
+using Chess::Bitboard;
+using Chess::Coordinates;
+using Chess::InstructionSet;
+using Chess::toSquare;
+using Chess::squareMask;
+
+/// Returns a bitboard containing all the coordinates given.
+Bitboard squaresOf(std::initializer_list<Coordinates> coords) {
+  Bitboard squares = 0;
+  for (auto const& coord : coords) {
+    squares |= squareMask(coord);
+  }
+  return squares;
+}
+
+TEST(AttacksTest, rookOnEmptyBoardAttacksItsRowAndColumn) {
+  auto attacks = Chess::rookAttacks(toSquare(Coordinates(3,3)), 0);
+  EXPECT_EQ(14, Chess::popCount(attacks));
+  EXPECT_TRUE(attacks & squareMask(Coordinates(3,0)));
+  EXPECT_TRUE(attacks & squareMask(Coordinates(3,7)));
+  EXPECT_TRUE(attacks & squareMask(Coordinates(0,3)));
+  EXPECT_TRUE(attacks & squareMask(Coordinates(7,3)));
+  EXPECT_FALSE(attacks & squareMask(Coordinates(3,3)));
+}
+
+TEST(AttacksTest, rookAttacksStopAtFirstPieceIncludingIt) {
+  auto occupied = squaresOf({Coordinates(0,2), Coordinates(2,0),
+                             Coordinates(0,5), Coordinates(7,7)});
+  auto expected = squaresOf({Coordinates(0,1), Coordinates(0,2),
+                             Coordinates(1,0), Coordinates(2,0)});
+  EXPECT_EQ(expected, Chess::rookAttacks(toSquare(Coordinates(0,0)), occupied));
+}
+
+TEST(AttacksTest, rookAttacksIgnorePiecesOutOfItsLines) {
+  auto occupied = squaresOf({Coordinates(1,1), Coordinates(6,6)});
+  EXPECT_EQ(Chess::rookAttacks(toSquare(Coordinates(0,0)), 0),
+            Chess::rookAttacks(toSquare(Coordinates(0,0)), occupied));
+}
+
+TEST(AttacksTest, bishopOnEmptyBoardAttacksItsDiagonals) {
+  auto attacks = Chess::bishopAttacks(toSquare(Coordinates(3,3)), 0);
+  EXPECT_EQ(13, Chess::popCount(attacks));
+  EXPECT_TRUE(attacks & squareMask(Coordinates(0,0)));
+  EXPECT_TRUE(attacks & squareMask(Coordinates(7,7)));
+  EXPECT_TRUE(attacks & squareMask(Coordinates(0,6)));
+  EXPECT_TRUE(attacks & squareMask(Coordinates(6,0)));
+}
+
+TEST(AttacksTest, bishopAttacksStopAtFirstPieceIncludingIt) {
+  auto occupied = squaresOf({Coordinates(5,5), Coordinates(6,6),
+                             Coordinates(2,2), Coordinates(4,2)});
+  auto expected = squaresOf({Coordinates(4,4), Coordinates(5,5),
+                             Coordinates(2,2), Coordinates(4,2),
+                             Coordinates(2,4), Coordinates(1,5),
+                             Coordinates(0,6)});
+  EXPECT_EQ(expected, Chess::bishopAttacks(toSquare(Coordinates(3,3)),
+                                           occupied));
+}
+
+TEST(AttacksTest, queenAttacksCombineRookAndBishop) {
+  auto occupied = squaresOf({Coordinates(3,5), Coordinates(5,5),
+                             Coordinates(1,3)});
+  auto square = toSquare(Coordinates(3,3));
+  EXPECT_EQ(Chess::rookAttacks(square, occupied) |
+            Chess::bishopAttacks(square, occupied),
+            Chess::queenAttacks(square, occupied));
+}
+
+TEST(AttacksTest, cornerRookAttacksAreCorrectForEveryBlockerOnItsRow) {
+  for (int column = 1; column <= 7; ++column) {
+    auto occupied = squareMask(Coordinates(column, 7));
+    auto attacks = Chess::rookAttacks(toSquare(Coordinates(0,7)), occupied);
+    EXPECT_EQ(column + 7, Chess::popCount(attacks));
+  }
+}
+
+TEST(AttacksTest, knightAttacksAreClippedAtTheCorner) {
+  auto expected = squaresOf({Coordinates(1,2), Coordinates(2,1)});
+  EXPECT_EQ(expected, Chess::knightAttacks(toSquare(Coordinates(0,0))));
+  EXPECT_EQ(8, Chess::popCount(Chess::knightAttacks(toSquare(Coordinates(3,3)))));
+}
+
+TEST(AttacksTest, kingAttacksSurroundingSquares) {
+  EXPECT_EQ(3, Chess::popCount(Chess::kingAttacks(toSquare(Coordinates(7,7)))));
+  EXPECT_EQ(8, Chess::popCount(Chess::kingAttacks(toSquare(Coordinates(4,4)))));
+}
+
+TEST(AttacksTest, pawnAttacksDiagonallyForwardAccordingToColour) {
+  auto square = toSquare(Coordinates(4,3));
+  EXPECT_EQ(squaresOf({Coordinates(3,4), Coordinates(5,4)}),
+            Chess::pawnAttacks(Chess::Colour::White, square));
+  EXPECT_EQ(squaresOf({Coordinates(3,2), Coordinates(5,2)}),
+            Chess::pawnAttacks(Chess::Colour::Black, square));
+  EXPECT_EQ(squaresOf({Coordinates(1,2)}),
+            Chess::pawnAttacks(Chess::Colour::White, toSquare(Coordinates(0,1))));
+}
+
+TEST(AttacksTest, pawnAttacksOfAColourKnownAtCompileTimeAreTheSame) {
+  for (int square = 0; square < 64; ++square) {
+    EXPECT_EQ(Chess::pawnAttacks(Chess::Colour::White, square),
+              Chess::pawnAttacks<Chess::Colour::White>(square));
+    EXPECT_EQ(Chess::pawnAttacks(Chess::Colour::Black, square),
+              Chess::pawnAttacks<Chess::Colour::Black>(square));
+  }
+}
+
+TEST(AttacksTest, leaperAttacksAreKnownAtCompileTime) {
+  static_assert(Chess::knightAttacks(toSquare(Coordinates(0,0))) ==
+                (squareMask(Coordinates(1,2)) | squareMask(Coordinates(2,1))));
+  static_assert(Chess::kingAttacks(toSquare(Coordinates(7,7))) ==
+                (squareMask(Coordinates(6,7)) | squareMask(Coordinates(6,6)) |
+                 squareMask(Coordinates(7,6))));
+  static_assert(Chess::pawnAttacks<Chess::Colour::Black>(
+                  toSquare(Coordinates(0,6))) == squareMask(Coordinates(1,5)));
+  EXPECT_EQ(0u, Chess::pawnAttacks(Chess::Colour::White,
+                                   toSquare(Coordinates(3,7))));
+}
+
+TEST(AttacksTest, portableInstructionsAreAlwaysSupported) {
+  EXPECT_TRUE(Chess::isSupported(InstructionSet::Portable));
+}
+
+TEST(AttacksTest, everySupportedKernelGivesBitIdenticalSliderAttacks) {
+  std::mt19937_64 random(2024);
+  for (auto set : {InstructionSet::Bmi2, InstructionSet::Avx2}) {
+    if (!Chess::isSupported(set)) {
+      EXPECT_THROW(Chess::rookAttacks(0, 0, set), std::invalid_argument);
+      continue;
+    }
+    for (int square = 0; square < 64; ++square) {
+      for (int i = 0; i < 100; ++i) {
+        // sparse occupancies, as real positions are
+        auto occupied = random() & random();
+        ASSERT_EQ(Chess::rookAttacks(square, occupied,
+                                     InstructionSet::Portable),
+                  Chess::rookAttacks(square, occupied, set));
+        ASSERT_EQ(Chess::bishopAttacks(square, occupied,
+                                       InstructionSet::Portable),
+                  Chess::bishopAttacks(square, occupied, set));
+        ASSERT_EQ(Chess::rookAttacks(square, occupied),
+                  Chess::rookAttacks(square, occupied, set));
+      }
+    }
+  }
+}
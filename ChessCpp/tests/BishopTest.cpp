@@ -23,51 +23,51 @@ protected:
 };
 
 TEST_F(BishopTest, canMoveDiagonallyForward) {
-  EXPECT_TRUE(bishop->isNormalMove(BISHOP_COORD, Coordinates(6, 6)));
+  EXPECT_TRUE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(6, 6)));
   EXPECT_NO_THROW(board.move(BISHOP_COORD, Coordinates(6, 6)));
 }
 
 TEST_F(BishopTest, canMoveDiagonallyBackward) {
-  EXPECT_TRUE(bishop->isNormalMove(BISHOP_COORD, Coordinates(0, 0)));
+  EXPECT_TRUE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(0, 0)));
   EXPECT_NO_THROW(board.move(BISHOP_COORD, Coordinates(0, 0)));
 }
 
 TEST_F(BishopTest, cannotMoveInStraightLines) {
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(3, 5)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(3, 5)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(3, 5)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(3, 1)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(3, 1)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(3, 1)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(5, 3)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(5, 3)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(5, 3)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(1, 3)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(1, 3)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(1, 3)), InvalidMove);
 }
 
 TEST_F(BishopTest, cannotMoveInLShape) {
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(4, 5)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(4, 5)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(4, 5)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(2, 5)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(2, 5)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(2, 5)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(4, 1)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(4, 1)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(4, 1)), InvalidMove);
   
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(2, 1)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(2, 1)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(2, 1)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(5, 4)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(5, 4)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(5, 4)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(5, 2)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(5, 2)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(5, 2)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(1, 4)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(1, 4)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(1, 4)), InvalidMove);
 
-  EXPECT_FALSE(bishop->isNormalMove(BISHOP_COORD, Coordinates(1, 2)));
+  EXPECT_FALSE(bishop->isNormalMove(board, BISHOP_COORD, Coordinates(1, 2)));
   EXPECT_THROW(board.move(BISHOP_COORD, Coordinates(1, 2)), InvalidMove);
 }
\ No newline at end of file
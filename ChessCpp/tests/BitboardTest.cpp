@@ -0,0 +1,74 @@
+#include "pch.h"
+#include "Bitboard.hpp"
+
+using Chess::Bitboard;
+using Chess::Coordinates;
+using Chess::toSquare;
+using Chess::toCoordinates;
+using Chess::squareMask;
+using Chess::between;
+
+TEST(BitboardTest, squaresAreNumberedFromA1ToH8) {
+  EXPECT_EQ(0, toSquare(Coordinates(0,0)));
+  EXPECT_EQ(7, toSquare(Coordinates(7,0)));
+  EXPECT_EQ(63, toSquare(Coordinates(7,7)));
+  EXPECT_EQ(Coordinates(4,3), toCoordinates(toSquare(Coordinates(4,3))));
+}
+
+TEST(BitboardTest, popLowestSquareRemovesSquaresInAscendingOrder) {
+  Bitboard squares = squareMask(3) | squareMask(40) | squareMask(63);
+  EXPECT_EQ(3, Chess::popCount(squares));
+  EXPECT_EQ(3, Chess::popLowestSquare(squares));
+  EXPECT_EQ(40, Chess::popLowestSquare(squares));
+  EXPECT_EQ(63, Chess::popLowestSquare(squares));
+  EXPECT_EQ(0u, squares);
+}
+
+TEST(BitboardTest, betweenSameRowExcludesExtremes) {
+  auto expected = squareMask(Coordinates(1,0)) | squareMask(Coordinates(2,0));
+  EXPECT_EQ(expected, between(toSquare(Coordinates(0,0)),
+                              toSquare(Coordinates(3,0))));
+  EXPECT_EQ(expected, between(toSquare(Coordinates(3,0)),
+                              toSquare(Coordinates(0,0))));
+}
+
+TEST(BitboardTest, betweenSameDiagonalExcludesExtremes) {
+  auto expected = squareMask(Coordinates(3,3)) | squareMask(Coordinates(4,4));
+  EXPECT_EQ(expected, between(toSquare(Coordinates(2,2)),
+                              toSquare(Coordinates(5,5))));
+}
+
+TEST(BitboardTest, betweenAdjacentSquaresIsEmpty) {
+  EXPECT_EQ(0u, between(toSquare(Coordinates(2,2)),
+                        toSquare(Coordinates(2,3))));
+}
+
+TEST(BitboardTest, betweenUnalignedSquaresIsEmpty) {
+  EXPECT_EQ(0u, between(toSquare(Coordinates(0,0)),
+                        toSquare(Coordinates(1,2))));
+}
+
+TEST(BitboardTest, lineSpansTheWholeDiagonalIncludingExtremes) {
+  Bitboard expected = 0;
+  for (int i = 0; i <= 7; ++i) {
+    expected |= squareMask(Coordinates(i,i));
+  }
+  EXPECT_EQ(expected, Chess::line(toSquare(Coordinates(2,2)),
+                                  toSquare(Coordinates(4,4))));
+}
+
+TEST(BitboardTest, lineOfUnalignedSquaresIsEmpty) {
+  EXPECT_EQ(0u, Chess::line(toSquare(Coordinates(0,0)),
+                            toSquare(Coordinates(1,2))));
+}
+
+TEST(BitboardTest, pushingMovesSquaresForwardForEachColour) {
+  using Chess::Colour;
+  auto squares = Chess::rowMask(0) | squareMask(Coordinates(3,4));
+  EXPECT_EQ(Chess::rowMask(1) | squareMask(Coordinates(3,5)),
+            Chess::pushed<Colour::White>(squares));
+  EXPECT_EQ(squareMask(Coordinates(3,3)),
+            Chess::pushed<Colour::Black>(squares));
+  static_assert(Chess::relativeRow<Colour::Black>(1) == 6);
+  static_assert(Chess::FORWARD<Colour::Black> == -8);
+}
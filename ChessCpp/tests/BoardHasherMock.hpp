@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "BoardHasher.hpp"
+#include "Position.hpp"
 
 using Chess::Coordinates;
 
@@ -7,12 +8,13 @@ class BoardHasherMock: public Chess::BoardHasher {
 public:
     MOCK_METHOD(void, pieceMoved, (Coordinates const& source,
                       Coordinates const& destination), (override));
-    MOCK_METHOD(int, hash, (), (override));
+    MOCK_METHOD(Chess::BoardHash, hash, (), (override));
     MOCK_METHOD(void, restorePreviousHash, (), (override));
     MOCK_METHOD(void, removed, (Coordinates const& coords), (override));
     MOCK_METHOD(void, replacedWithPromotion, (Coordinates const& source,
                                     Chess::PromotionOption prom,
                                     Chess::Colour colour), (override));
     MOCK_METHOD(void, reset, (), (override));
+    MOCK_METHOD(void, reset, (Chess::Position const& position), (override));
     MOCK_METHOD(void, togglePlayer, (), (override));
 };
\ No newline at end of file
@@ -11,6 +11,8 @@ using Chess::MoveResult;
 using Chess::PromotionOption;
 using Chess::Coordinates;
 using Chess::CastlingType;
+using Chess::Move;
+using Chess::MoveList;
 using ::testing::AtLeast;
 using ::testing::NiceMock;
 
@@ -29,6 +31,15 @@ protected:
      }}, Chess::InvalidMove);
   }
 
+  void tryMoveAndTestError(std::string_view src, std::string_view dest,
+                           InvalidMove::ErrorCode err) {
+    EXPECT_NO_THROW({
+      auto attempt = board.tryMove(src, dest);
+      EXPECT_FALSE(attempt.hasValue());
+      EXPECT_EQ(attempt.errorCode(), err);
+    });
+  }
+
   decltype(auto) buildNiceBoardHasherMock() {
     return std::make_unique<NiceMock<BoardHasherMock>>();
   }
@@ -130,6 +141,87 @@ TEST_F(BoardTest, throwsIfAttemptedMoveWhilePromotionIsPending) {
   moveAndTestThrow("C8", "D8", InvalidMove::ErrorCode::PENDING_PROMOTION);
 }
 
+TEST_F(BoardTest, tryMoveReportsInvalidMovesWithoutThrowing) {
+  tryMoveAndTestError("A9", "A2", InvalidMove::ErrorCode::INVALID_COORDINATES);
+  tryMoveAndTestError("A2", "", InvalidMove::ErrorCode::INVALID_COORDINATES);
+  tryMoveAndTestError("A3", "A4", InvalidMove::ErrorCode::NO_SOURCE_PIECE);
+  tryMoveAndTestError("A7", "A6", InvalidMove::ErrorCode::WRONG_TURN);
+  tryMoveAndTestError("A1", "A5", InvalidMove::ErrorCode::PIECE_LOGIC_ERROR);
+  EXPECT_EQ(InvalidMove::ErrorCode::INVALID_COORDINATES,
+            board.tryMove(Coordinates(0, 1), Coordinates(0, 8)).errorCode());
+  EXPECT_EQ(InvalidMove::ErrorCode::INVALID_COORDINATES,
+            board.tryMove(Coordinates(-1, 1), Coordinates(0, 2)).errorCode());
+
+  board.move("B2", "B3"); board.move("C7", "C5");
+  board.move("G2", "G3"); board.move("D8", "A5");
+  tryMoveAndTestError("D2", "D3", InvalidMove::ErrorCode::CHECK_ERROR);
+}
+
+TEST_F(BoardTest, tryMoveReportsPendingPromotionAndGameOver) {
+  movePawnsForPromotion();
+  board.move("C7", "B8");
+  tryMoveAndTestError("A7", "A6", InvalidMove::ErrorCode::PENDING_PROMOTION);
+
+  board = Board();
+  board.move("F2", "F3"); board.move("E7", "E5");
+  board.move("G2", "G4"); board.move("D8", "H4");
+  tryMoveAndTestError("A2", "A3", InvalidMove::ErrorCode::GAME_OVER);
+}
+
+TEST_F(BoardTest, tryMoveExecutesValidMoves) {
+  auto attempt = board.tryMove("E2", "E4");
+  ASSERT_TRUE(attempt);
+  EXPECT_EQ(MoveResult::GameState::NORMAL, attempt.value().gameState());
+  EXPECT_FALSE(board.at(Coordinates(4, 3)) == nullptr);
+  EXPECT_EQ(Chess::Colour::Black, board.currentPlayer());
+  EXPECT_THROW(attempt.errorCode(), std::logic_error);
+}
+
+TEST_F(BoardTest, tryMoveLeavesTheBoardUntouchedOnError) {
+  board.tryMove("A1", "A5");
+  EXPECT_EQ(Chess::Colour::White, board.currentPlayer());
+  EXPECT_NO_THROW(board.move("A2", "A4"));
+}
+
+TEST_F(BoardTest, errorMessagesAreBuiltOnRequest) {
+  EXPECT_EQ("White's Rook cannot move from A1 to A5",
+            board.tryMove("A1", "A5").errorMessage());
+  EXPECT_EQ("There is no piece at position A3",
+            board.tryMove("A3", "A4").errorMessage());
+  EXPECT_EQ("It is not Black's turn to move",
+            board.tryMove("A7", "A6").errorMessage());
+}
+
+TEST_F(BoardTest, invalidCoordinatesAreExplainedAsWhenThrowing) {
+  EXPECT_EQ("A9 is an invalid coordinate pair. Row must be within 1 and 8",
+            board.tryMove("A9", "A2").errorMessage());
+  EXPECT_EQ("Z2 is an invalid coordinate pair. Column must be within A and H",
+            board.tryMove("A2", "Z2").errorMessage());
+  for (auto [source, destination] : {std::pair("A-1", "A2"),
+                                     std::pair("A2", "")}) {
+    try {
+      board.move(source, destination);
+      FAIL() << "Expected an InvalidMove exception";
+    } catch (InvalidMove const& e) {
+      EXPECT_EQ(board.tryMove(source, destination).errorMessage(), e.what());
+    }
+  }
+  EXPECT_EQ(std::nullopt, Board::invalidCoordinatesReason("H8"));
+  EXPECT_THROW(Board::stringToCoordinates("A-1"), std::invalid_argument);
+  EXPECT_THROW(Board::stringToCoordinates("I1"), std::out_of_range);
+}
+
+TEST_F(BoardTest, valueOfAnInvalidAttemptThrowsTheCorrespondingException) {
+  auto attempt = board.tryMove("A1", "A5");
+  try {
+    attempt.value();
+    FAIL() << "Expected an InvalidMove exception";
+  } catch (InvalidMove const& e) {
+    EXPECT_EQ(InvalidMove::ErrorCode::PIECE_LOGIC_ERROR, e.errorCode());
+    EXPECT_EQ(attempt.errorMessage(), e.what());
+  }
+}
+
 TEST_F(BoardTest, throwsIfTheBoardIsConstructedWithANullHasher) {
   EXPECT_THROW(board = Board(nullptr), std::invalid_argument);
 }
@@ -273,6 +365,16 @@ TEST_F(BoardTest, threeFoldRepetitionAllowsToClaimDraw) {
   EXPECT_TRUE(board.drawCanBeClaimed());
 }
 
+TEST_F(BoardTest, theInitialPositionCountsTowardsRepetition) {
+  board.move("G1", "F3"); board.move("G8", "F6");
+  board.move("F3", "G1"); board.move("F6", "G8");
+  board.move("G1", "F3"); board.move("G8", "F6");
+  board.move("F3", "G1");
+  EXPECT_FALSE(board.drawCanBeClaimed());
+  board.move("F6", "G8");
+  EXPECT_TRUE(board.drawCanBeClaimed());
+}
+
 TEST_F(BoardTest, claimingDrawWhenAppropriateEndsTheGame) {
   doThreeFoldRepetition();
   EXPECT_FALSE(board.isGameOver());
@@ -387,6 +489,25 @@ TEST_F(BoardTest, cannotCastleIfPathIsUnderAttack) {
   moveAndTestThrow(wKingCoord, "G1", InvalidMove::ErrorCode::PIECE_LOGIC_ERROR);
 }
 
+TEST_F(BoardTest, cannotCastleQueenSideIfKnightSquareIsOccupied) {
+  using Chess::King;
+  board = Board({}, {Coordinates(0, 0)}, {}, {}, {}, King::WHITE_STD_INIT,
+    {}, {}, {Coordinates(1, 0)}, {}, {}, King::BLACK_STD_INIT);
+  auto wKingCoord = Board::coordinatesToString(King::WHITE_STD_INIT);
+  moveAndTestThrow(wKingCoord, "C1", InvalidMove::ErrorCode::PIECE_LOGIC_ERROR);
+}
+
+TEST_F(BoardTest, cannotCastleWithAPiecePromotedOnTheRookSquare) {
+  using Chess::King;
+  board = Board({Coordinates(0, 1)}, {Coordinates(7, 0)}, {}, {}, {},
+    King::WHITE_STD_INIT, {Coordinates(6, 1)}, {}, {}, {}, {},
+    King::BLACK_STD_INIT);
+  board.move("A2", "A3"); board.move("G2", "H1");
+  board.promote(PromotionOption::Bishop);
+  auto wKingCoord = Board::coordinatesToString(King::WHITE_STD_INIT);
+  moveAndTestThrow(wKingCoord, "G1", InvalidMove::ErrorCode::PIECE_LOGIC_ERROR);
+}
+
 TEST_F(BoardTest, undoingWithNoRecordedMovesDoesNothing) {
   EXPECT_NO_THROW(board.undoLastMove());
 }
@@ -514,6 +635,16 @@ TEST_F(BoardTest, canUndoThreeFoldRepetition) {
   EXPECT_FALSE(board.drawCanBeClaimed());
 }
 
+TEST_F(BoardTest, redoingAnUndoneRepetitionAllowsToClaimDrawAgain) {
+  doThreeFoldRepetition();
+  board.undoLastMove();
+  board.undoLastMove();
+  board.move("D2", "D1");
+  EXPECT_FALSE(board.drawCanBeClaimed());
+  board.move("D7", "D8");
+  EXPECT_TRUE(board.drawCanBeClaimed());
+}
+
 TEST_F(BoardTest, canUndoFiveFoldRepetition) {
   doThreeFoldRepetition();
   board.move("D1", "D2"); board.move("D8", "D7");
@@ -721,6 +852,20 @@ TEST_F(BoardTest, hasherIsNotifiedOfCapturedPieceDuringEnPassant) {
   board.move("E5", "D6");
 }
 
+TEST_F(BoardTest, undoingEnPassantRestoresTheHash) {
+  board.move("E2", "E4"); board.move("H7", "H5");
+  board.move("E4", "E5"); board.move("D7", "D5");
+  auto hashBeforeEnPassant = board.hash();
+  board.move("E5", "D6");
+  board.undoLastMove();
+  EXPECT_EQ(hashBeforeEnPassant, board.hash());
+
+  // earlier moves must be undone consistently too
+  board.undoLastMove();
+  board.move("D7", "D5");
+  EXPECT_EQ(hashBeforeEnPassant, board.hash());
+}
+
 TEST_F(BoardTest, boardCanBeInstantiatedWithANonStandardInitialConfiguration) {
   board = Board({}, {Coordinates(2, 3), Coordinates(1, 2),
     Coordinates(2, 2)}, {}, {}, {}, Coordinates(1,1), {}, {}, {}, {},
@@ -855,7 +1000,8 @@ TEST_F(BoardTest, pawnsInitialisedInEnPassantCannotExecuteIt) {
   {Coordinates(3, 4)}, {}, {}, {}, {}, Coordinates(7, 7));
   auto whitePawn = board.at(Coordinates(2, 4));
   ASSERT_FALSE(whitePawn == nullptr);
-  EXPECT_FALSE(whitePawn->isNormalMove(Coordinates(2,4), Coordinates(3,5)));
+  EXPECT_FALSE(whitePawn->isNormalMove(board, Coordinates(2,4),
+                                       Coordinates(3,5)));
 }
 
 TEST_F(BoardTest, kingVsKingCausesDraw) {
@@ -904,14 +1050,328 @@ TEST_F(BoardTest, kingAndKnightVsKingAndBishopCausesDraw) {
   EXPECT_TRUE(board.isGameOver());
 }
 
+TEST_F(BoardTest, materialFollowsPromotionsAndUndos) {
+  board = Board({Coordinates(0, 6)}, {}, {}, {}, {}, Coordinates(4, 0),
+                {}, {}, {}, {}, {}, Coordinates(7, 5));
+  board.move(Coordinates(0, 6), Coordinates(0, 7));
+  auto result = board.promote(PromotionOption::Knight);
+  EXPECT_EQ(MoveResult::GameState::INSUFFICIENT_MATERIAL_DRAW,
+            result->gameState());
+
+  board.undoLastMove();
+  board.move(Coordinates(0, 6), Coordinates(0, 7));
+  result = board.promote(PromotionOption::Rook);
+  EXPECT_EQ(MoveResult::GameState::NORMAL, result->gameState());
+  EXPECT_FALSE(board.isGameOver());
+}
+
+TEST_F(BoardTest, twentyMovesAreGeneratedInTheStartingPosition) {
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  EXPECT_EQ(moves.size(), 20);
+  EXPECT_THAT(moves, ::testing::Contains(Move(Coordinates(4, 1),
+                                              Coordinates(4, 3))));
+  EXPECT_THAT(moves, ::testing::Contains(Move(Coordinates(6, 0),
+                                              Coordinates(5, 2))));
+}
+
+TEST_F(BoardTest, generatedMovesReplaceThePreviousContentOfTheList) {
+  MoveList moves;
+  for (int i = 0; i < 5; ++i) {
+    moves.emplace_back(Coordinates(0, 0), Coordinates(0, 1));
+  }
+  board.generateLegalMoves(moves);
+  EXPECT_EQ(moves.size(), 20);
+}
+
+TEST_F(BoardTest, everyGeneratedMoveCanBePerformed) {
+  testAlekhineVsVasic1931();
+  board.undoLastMove();
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  ASSERT_FALSE(moves.empty());
+  for (auto const& move : moves) {
+    EXPECT_NO_THROW(board.move(move));
+    board.undoLastMove();
+  }
+}
+
+TEST_F(BoardTest, onlyMovesResolvingACheckAreGenerated) {
+  board.move("E2", "E4"); board.move("F7", "F6");
+  board.move("D1", "H5");
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  EXPECT_THAT(moves, ::testing::UnorderedElementsAre(
+                       Move(Coordinates(6, 6), Coordinates(6, 5))));
+}
+
+TEST_F(BoardTest, castlingIsGeneratedAsAMoveOfTheKing) {
+  board.move("G1", "F3"); board.move("G8", "F6");
+  board.move("G2", "G3"); board.move("G7", "G6");
+  board.move("F1", "G2"); board.move("F8", "G7");
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  EXPECT_THAT(moves, ::testing::Contains(Move(Coordinates(4, 0),
+                                              Coordinates(6, 0))));
+}
+
+TEST_F(BoardTest, generatedMovesAreMarkedWithTheirKind) {
+  board.move("E2", "E4"); board.move("H7", "H6");
+  board.move("E4", "E5"); board.move("H6", "H5");
+  board.move("G1", "F3"); board.move("H5", "H4");
+  board.move("F1", "E2"); board.move("D7", "D5");
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  auto kindOf = [&moves](std::string_view src, std::string_view dest) {
+    for (auto const& move : moves) {
+      if (move == Move(Board::stringToCoordinates(src),
+                       Board::stringToCoordinates(dest))) {
+        return move.kind();
+      }
+    }
+    ADD_FAILURE() << src << dest << " was not generated";
+    return Move::Kind::Normal;
+  };
+  EXPECT_EQ(Move::Kind::Castling, kindOf("E1", "G1"));
+  EXPECT_EQ(Move::Kind::EnPassant, kindOf("E5", "D6"));
+  EXPECT_EQ(Move::Kind::Normal, kindOf("E5", "E6"));
+}
+
+TEST_F(BoardTest, movesCarryingAPromotionArePerformedInOneCall) {
+  movePawnsForPromotion();
+  auto result = board.move(Move(Coordinates(2, 6), Coordinates(1, 7),
+                                PromotionOption::Knight));
+  EXPECT_FALSE(board.promotionPending());
+  EXPECT_EQ(Chess::PieceType::Knight, board.at(Coordinates(1, 7))->type());
+  EXPECT_NE(MoveResult::GameState::AWAITING_PROMOTION, result.gameState());
+  EXPECT_EQ(Chess::Colour::Black, board.currentPlayer());
+}
+
+TEST_F(BoardTest, throwsIfAPromotionIsGivenForAMoveNotNeedingOne) {
+  auto pawn = board.at(Coordinates(4, 1));
+  EXPECT_THROW(board.move(Move(Coordinates(4, 1), Coordinates(4, 3),
+                               PromotionOption::Queen)), InvalidMove);
+  EXPECT_EQ(pawn, board.at(Coordinates(4, 1)));
+  EXPECT_EQ(Chess::Colour::White, board.currentPlayer());
+}
+
+TEST_F(BoardTest, castlingIsNotGeneratedIfPathIsUnderAttack) {
+  using Chess::King;
+  board = Board({}, {Coordinates(7, 0)}, {}, {}, {}, King::WHITE_STD_INIT,
+    {}, {Coordinates(6, 7)}, {}, {}, {}, King::BLACK_STD_INIT);
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  EXPECT_THAT(moves, ::testing::Not(::testing::Contains(
+                      Move(King::WHITE_STD_INIT, Coordinates(6, 0)))));
+}
+
+TEST_F(BoardTest, enPassantIsGenerated) {
+  board.move("E2", "E4"); board.move("H7", "H5");
+  board.move("E4", "E5"); board.move("D7", "D5");
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  EXPECT_THAT(moves, ::testing::Contains(Move(Coordinates(4, 4),
+                                              Coordinates(3, 5))));
+}
+
+TEST_F(BoardTest, enPassantExposingTheKingIsNotGenerated) {
+  board = Board({Coordinates(4, 4)}, {}, {}, {}, {}, Coordinates(6, 3),
+                {Coordinates(3, 6)}, {Coordinates(0, 4)}, {}, {}, {},
+                Coordinates(7, 7));
+  board.move("G4", "H5"); board.move("D7", "D5");
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  EXPECT_THAT(moves, ::testing::Not(::testing::Contains(
+                      Move(Coordinates(4, 4), Coordinates(3, 5)))));
+}
+
+TEST_F(BoardTest, everyPromotionOptionIsGenerated) {
+  movePawnsForPromotion();
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  for (auto option : {PromotionOption::Queen, PromotionOption::Rook,
+                      PromotionOption::Bishop, PromotionOption::Knight}) {
+    EXPECT_THAT(moves, ::testing::Contains(Move(Coordinates(2, 6),
+                                                Coordinates(1, 7), option)));
+  }
+  EXPECT_THAT(moves, ::testing::Not(::testing::Contains(
+                      Move(Coordinates(2, 6), Coordinates(1, 7)))));
+}
+
+TEST_F(BoardTest, noMovesAreGeneratedWhilePromotionIsPending) {
+  movePawnsForPromotion();
+  board.move("C7", "B8");
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  EXPECT_TRUE(moves.empty());
+}
+
+TEST_F(BoardTest, noMovesAreGeneratedAfterTheGameIsOver) {
+  testAlekhineVsVasic1931();
+  MoveList moves;
+  board.generateLegalMoves(moves);
+  EXPECT_TRUE(moves.empty());
+}
+
+TEST_F(BoardTest, attackersToListsEveryPieceAttackingTheSquare) {
+  using Chess::squareMask;
+  auto expected = squareMask(Coordinates(4, 1)) | squareMask(Coordinates(6, 1)) |
+                  squareMask(Coordinates(6, 0));
+  EXPECT_EQ(board.attackersTo(Coordinates(5, 2), Chess::Colour::White),
+            expected);
+  EXPECT_EQ(board.attackersTo(Coordinates(5, 2), Chess::Colour::Black), 0u);
+}
+
+TEST_F(BoardTest, attackersToIgnoresBlockedSliders) {
+  using Chess::squareMask;
+  auto expected = squareMask(Coordinates(2, 1)) | squareMask(Coordinates(4, 1));
+  EXPECT_EQ(board.attackersTo(Coordinates(3, 2), Chess::Colour::White),
+            expected);
+  board.move("D2", "D4");
+  EXPECT_TRUE(board.attackersTo(Coordinates(3, 2), Chess::Colour::White) &
+              squareMask(Coordinates(3, 0)));
+}
+
+TEST_F(BoardTest, piecesFollowMovesCapturesAndUndos) {
+  using Chess::squareMask;
+  board.move("E2", "E4"); board.move("D7", "D5");
+  board.move("E4", "D5");
+  EXPECT_EQ(squareMask({3, 4}) | squareMask({0, 1}) | squareMask({1, 1}) |
+            squareMask({2, 1}) | squareMask({3, 1}) | squareMask({5, 1}) |
+            squareMask({6, 1}) | squareMask({7, 1}),
+            board.pieces(Chess::Colour::White, Chess::PieceType::Pawn));
+  EXPECT_EQ(15, Chess::popCount(board.pieces(Chess::Colour::Black)));
+
+  board.undoLastMove();
+  EXPECT_EQ(16, Chess::popCount(board.pieces(Chess::Colour::Black)));
+  EXPECT_NE(0u, board.pieces(Chess::Colour::Black, Chess::PieceType::Pawn) &
+                squareMask({3, 4}));
+}
+
+TEST_F(BoardTest, attackersToThrowsIfOutOfBounds) {
+  EXPECT_THROW(board.attackersTo(Coordinates(8, 0), Chess::Colour::White),
+               std::out_of_range);
+}
+
 TEST_F(BoardTest, callingResetResetsTheInternalState) {
   testAlekhineVsVasic1931();
   board.reset();
   testAlekhineVsVasic1931();
 }
 
+TEST_F(BoardTest, resettingToAPositionRestartsFromIt) {
+  board.move("E2", "E4"); board.move("A7", "A6");
+  board.move("E4", "E5"); board.move("D7", "D5");
+  auto start = board.position();
+
+  for (int game = 0; game < 3; ++game) {
+    board.move("E5", "D6");
+    board.move("C7", "D6");
+    board.reset(start);
+    EXPECT_EQ(start, board.position());
+    EXPECT_EQ(start.key, board.hash());
+  }
+  board.reset();
+  testAlekhineVsVasic1931();
+}
+
+TEST_F(BoardTest, resettingToAnInvalidPositionLeavesTheBoardUnchanged) {
+  board.move("E2", "E4");
+  auto position = board.position();
+  auto invalid = position;
+  invalid.pieces[static_cast<size_t>(Chess::PieceType::Pawn)] |=
+                                                  Chess::squareMask({0, 7});
+  EXPECT_THROW(board.reset(invalid), std::invalid_argument);
+  EXPECT_EQ(position, board.position());
+}
+
+TEST_F(BoardTest, impossibleDoubleStepsAreRejectedBeforeResetting) {
+  board.move("E2", "E4"); board.move("A7", "A6");
+  board.move("E4", "E5"); board.move("D7", "D5");
+  auto position = board.position();
+  auto blocked = position;
+  auto middle = Chess::squareMask(Board::stringToCoordinates("D6"));
+  blocked.pieces[static_cast<size_t>(Chess::PieceType::Knight)] |= middle;
+  blocked.colours[static_cast<size_t>(Chess::Colour::White)] |= middle;
+  blocked.key = blocked.computeKey();
+
+  Board other;
+  other.move("G1", "F3");
+  auto otherPosition = other.position();
+  EXPECT_THROW(other.reset(blocked), std::invalid_argument);
+  EXPECT_EQ(otherPosition, other.position());
+
+  auto lateCount = position;
+  lateCount.countSincePawnMoveOrCapture = 150;
+  EXPECT_NO_THROW(other.reset(lateCount));
+  EXPECT_EQ(150, other.position().countSincePawnMoveOrCapture);
+}
+
 TEST_F(BoardTest, moveAssignmentOverwritesTheInternalState) {
   testAlekhineVsVasic1931();
   board = Board();
   testAlekhineVsVasic1931();
-}
\ No newline at end of file
+}
+
+TEST_F(BoardTest, boardsKeepPlayingAfterBeingMovedOrSwapped) {
+  board.move("E2", "E4");
+  board.move("D7", "D5");
+  std::vector<Board> boards;
+  boards.push_back(std::move(board));
+  boards.emplace_back();
+  std::swap(boards[0], boards[1]);
+
+  EXPECT_NO_THROW(boards[0].move("E2", "E4"));
+  auto pawn = boards[1].at(Board::stringToCoordinates("E4"));
+  EXPECT_TRUE(pawn->isNormalMove(boards[1], Board::stringToCoordinates("E4"),
+                                 Board::stringToCoordinates("D5")));
+  EXPECT_EQ("Pawn", boards[1].move("E4", "D5").capturedPieceName());
+  boards[1].undoLastMove();
+  EXPECT_NE(nullptr, boards[1].at(Board::stringToCoordinates("D5")));
+}
+
+TEST_F(BoardTest, promotingAndUndoingRepeatedlyKeepsThePawn) {
+  movePawnsForPromotion();
+  auto pawn = board.at(Coordinates(2, 6));
+  // far more promotions than pieces a game can hold
+  for (int i = 0; i < 1000; ++i) {
+    board.move(Move(Coordinates(2, 6), Coordinates(1, 7),
+                    PromotionOption::Queen));
+    ASSERT_EQ(Chess::PieceType::Queen, board.at(Coordinates(1, 7))->type());
+    board.undoLastMove();
+  }
+  EXPECT_EQ(pawn, board.at(Coordinates(2, 6)));
+  EXPECT_EQ(Chess::PieceType::Knight, board.at(Coordinates(1, 7))->type());
+}
+
+TEST_F(BoardTest, moveResultsDescribeTheMovesMade) {
+  auto result = board.move("E2", "E4");
+  EXPECT_EQ(Chess::PieceType::Pawn, result.movedPiece());
+  EXPECT_EQ(Move({4, 1}, {4, 3}), result.move());
+  EXPECT_EQ(std::nullopt, result.capturedPiece());
+
+  board.move("A7", "A6"); board.move("E4", "E5"); board.move("D7", "D5");
+  result = board.move("E5", "D6");
+  EXPECT_EQ(Move({4, 4}, {3, 5}, Move::Kind::EnPassant), result.move());
+  EXPECT_EQ(Chess::PieceType::Pawn, result.capturedPiece());
+  EXPECT_EQ("Pawn", result.capturedPieceName());
+
+  result = board.move("C7", "D6");
+  EXPECT_EQ(Chess::PieceType::Pawn, result.capturedPiece());
+  board.move("G1", "F3"); board.move("C8", "G4");
+  board.move("F1", "E2"); board.move("G4", "F3");
+  result = board.move("E1", "G1");
+  EXPECT_EQ(CastlingType::KingSide, result.castlingType());
+  EXPECT_EQ(Chess::PieceType::King, result.movedPiece());
+  EXPECT_EQ(Move({4, 0}, {6, 0}, Move::Kind::Castling), result.move());
+  EXPECT_EQ(std::nullopt, result.capturedPiece());
+}
+
+TEST_F(BoardTest, promotionResultsReportThePawnMoveAndCapture) {
+  movePawnsForPromotion();
+  auto result = board.move(Move({2, 6}, {1, 7}, PromotionOption::Rook));
+  EXPECT_EQ(Chess::PieceType::Pawn, result.movedPiece());
+  EXPECT_EQ(Move({2, 6}, {1, 7}, PromotionOption::Rook), result.move());
+  EXPECT_EQ(Chess::PieceType::Knight, result.capturedPiece());
+  EXPECT_EQ(std::nullopt, result.castlingType());
+}
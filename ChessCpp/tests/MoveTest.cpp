@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "Move.hpp"
+
+using Chess::Coordinates;
+using Chess::Move;
+using Chess::MoveList;
+using Chess::PromotionOption;
+
+TEST(MoveTest, movesArePackedInSixteenBits) {
+  EXPECT_EQ(2u, sizeof(Move));
+}
+
+TEST(MoveTest, sourceAndDestinationAreKeptForEverySquare) {
+  for (int source = 0; source < 64; ++source) {
+    for (int destination = 0; destination < 64; ++destination) {
+      Move move(Chess::toCoordinates(source), Chess::toCoordinates(destination));
+      EXPECT_EQ(Chess::toCoordinates(source), move.source());
+      EXPECT_EQ(Chess::toCoordinates(destination), move.destination());
+    }
+  }
+}
+
+TEST(MoveTest, promotionIsKeptForEveryOption) {
+  for (auto option : {PromotionOption::Knight, PromotionOption::Bishop,
+                      PromotionOption::Rook, PromotionOption::Queen}) {
+    Move move(Coordinates(7, 6), Coordinates(7, 7), option);
+    ASSERT_TRUE(move.promotion().has_value());
+    EXPECT_EQ(option, *move.promotion());
+    EXPECT_EQ(Move::Kind::Promotion, move.kind());
+    EXPECT_EQ(Coordinates(7, 7), move.destination());
+  }
+}
+
+TEST(MoveTest, movesWithoutPromotionHaveNone) {
+  EXPECT_FALSE(Move(Coordinates(4, 1), Coordinates(4, 3)).promotion());
+  EXPECT_FALSE(Move(Coordinates(4, 0), Coordinates(6, 0),
+                    Move::Kind::Castling).promotion());
+  EXPECT_EQ(Move::Kind::Normal, Move(Coordinates(4, 1), Coordinates(4, 3)).kind());
+}
+
+TEST(MoveTest, equalityIgnoresTheKindButNotThePromotion) {
+  Move castling(Coordinates(4, 0), Coordinates(6, 0), Move::Kind::Castling);
+  EXPECT_EQ(Move(Coordinates(4, 0), Coordinates(6, 0)), castling);
+
+  Move queen(Coordinates(0, 6), Coordinates(0, 7), PromotionOption::Queen);
+  Move rook(Coordinates(0, 6), Coordinates(0, 7), PromotionOption::Rook);
+  EXPECT_NE(queen, rook);
+  EXPECT_NE(queen, Move(Coordinates(0, 6), Coordinates(0, 7)));
+}
+
+TEST(MoveTest, moveListHoldsMovesInOrder) {
+  MoveList moves;
+  EXPECT_TRUE(moves.empty());
+  moves.emplace_back(Coordinates(0, 1), Coordinates(0, 2));
+  moves.push_back(Move(Coordinates(1, 1), Coordinates(1, 3)));
+  ASSERT_EQ(2u, moves.size());
+  EXPECT_EQ(Move(Coordinates(0, 1), Coordinates(0, 2)), moves[0]);
+  EXPECT_EQ(Move(Coordinates(1, 1), Coordinates(1, 3)), *(moves.begin() + 1));
+
+  moves.clear();
+  EXPECT_TRUE(moves.empty());
+  EXPECT_EQ(moves.begin(), moves.end());
+}
+
+TEST(MoveTest, moveListCanBeFilledToCapacity) {
+  MoveList moves;
+  for (size_t i = 0; i < MoveList::CAPACITY; ++i) {
+    moves.emplace_back(Coordinates(0, 0), Coordinates(0, 1));
+  }
+  EXPECT_EQ(MoveList::CAPACITY, moves.size());
+}
@@ -0,0 +1,77 @@
+#include "pch.h"
+#include "Perft.hpp"
+
+using Chess::Board;
+using Chess::PerftPosition;
+
+/// Defines the largest leaf count checked, to keep the tests quick.
+std::uint64_t constexpr MAX_TESTED_NODES = 200000;
+
+class PerftTest : public ::testing::TestWithParam<PerftPosition> {};
+
+TEST_P(PerftTest, leafCountsMatchTheKnownOnes) {
+  auto const& position = GetParam();
+  auto board = position.build();
+  for (size_t i = 0; i < position.expectedNodes.size() &&
+                     position.expectedNodes[i] <= MAX_TESTED_NODES; ++i) {
+    EXPECT_EQ(position.expectedNodes[i], Chess::perft(board, i + 1))
+      << position.name << " at depth " << i + 1;
+  }
+}
+
+TEST_P(PerftTest, divisionsAddUpToTheLeafCount) {
+  auto const& position = GetParam();
+  auto board = position.build();
+  std::uint64_t total = 0;
+  for (auto const& division : Chess::perftDivide(board, 2)) {
+    total += division.nodes;
+  }
+  EXPECT_EQ(position.expectedNodes[1], total);
+}
+
+TEST_P(PerftTest, threadsAgreeWithASingleThread) {
+  auto const& position = GetParam();
+  auto board = position.build();
+  auto expected = Chess::perftDivide(board, 3);
+  for (auto tableEntries : {std::size_t(0), std::size_t(1) << 12}) {
+    Chess::ParallelPerftOptions options;
+    options.threads = 4;
+    options.tableEntries = tableEntries;
+    auto divisions = Chess::perftDivideParallel(position.build, 3, options);
+    ASSERT_EQ(expected.size(), divisions.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i].move, divisions[i].move);
+      EXPECT_EQ(expected[i].nodes, divisions[i].nodes);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(StandardPositions, PerftTest,
+  ::testing::ValuesIn(Chess::standardPerftPositions()),
+  [](auto const& info) { return std::string(info.param.name); });
+
+TEST(PerftTest, boardIsRestoredAfterCounting) {
+  Board board;
+  Chess::perft(board, 3);
+  EXPECT_EQ(20u, Chess::perft(board, 1));
+  EXPECT_EQ(Chess::Colour::White, board.currentPlayer());
+  EXPECT_NO_THROW(board.move("E2", "E4"));
+}
+
+TEST(PerftTest, depthZeroCountsTheRootOnly) {
+  Board board;
+  EXPECT_EQ(1u, Chess::perft(board, 0));
+  EXPECT_TRUE(Chess::perftDivide(board, 0).empty());
+}
+
+TEST(PerftTest, threadsCountTranspositionsOnce) {
+  Chess::ParallelPerftOptions options;
+  options.threads = 3;
+  options.tableEntries = 1000;
+  EXPECT_EQ(197281u, Chess::perftParallel([]() { return Board(); }, 4, options));
+}
+
+TEST(PerftTest, errorsOfThreadsAreRethrown) {
+  auto build = []() -> Board { throw std::runtime_error("cannot build"); };
+  EXPECT_THROW(Chess::perftParallel(build, 2), std::runtime_error);
+}
@@ -8,56 +8,63 @@ using Chess::Colour;
 
 class PieceStub : public Chess::Piece {
 public:
-  PieceStub(Colour colour, Chess::Board& board): Piece(colour, board) {}
+  explicit PieceStub(Colour colour): Piece(colour) {}
 
-  Chess::MoveResult move(Coordinates const& source,
+  Chess::MoveResult move(Chess::AbstractBoard& board, Coordinates const& source,
                          Coordinates const& destination) override {
     return Chess::MoveResult(Chess::MoveResult::GameState::NORMAL);
   }
 
   std::string name() const { return ""; }
 
+  Chess::PieceType type() const { return Chess::PieceType::Pawn; }
+
 private:
-  virtual bool isNormalMoveSpecific(Coordinates const& source,
-                                       Coordinates const& destination) const {
+  virtual bool isNormalMoveSpecific(Chess::AbstractBoard const& board,
+                                    Coordinates const& source,
+                                    Coordinates const& destination) const {
     return true;
   }
 };
 
 class PieceTest : public ::testing::Test {
 private:
-  PieceStub stub{Colour::White, board};
+  PieceStub stub{Colour::White};
 protected:
   Chess::Board board;
   Chess::Piece& piece{stub};
 };
 
 TEST_F(PieceTest, cannotMoveFromOutOfBoundsCoordinates) {
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(-1, 0), Coordinates(0, 0)));
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(0, -1), Coordinates(0, 0)));
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(Board::MAX_COL_NUM+1, 0),
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(-1, 0),
+                                  Coordinates(0, 0)));
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(0, -1),
+                                  Coordinates(0, 0)));
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(Board::MAX_COL_NUM+1, 0),
                                      Coordinates(0, 0)));
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(0, Board::MAX_ROW_NUM+1),
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(0, Board::MAX_ROW_NUM+1),
                                      Coordinates(0, 0)));
 }
 
 TEST_F(PieceTest, cannotMoveToOutOfBoundsCoordinates) {
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(0, 0), Coordinates(-1, 0)));
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(0, 0), Coordinates(0, -1)));
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(0, 0),
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(0, 0),
+                                  Coordinates(-1, 0)));
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(0, 0),
+                                  Coordinates(0, -1)));
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(0, 0),
                                   Coordinates(Board::MAX_COL_NUM + 1, 0)));
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(0, 0),
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(0, 0),
                                   Coordinates(0, Board::MAX_ROW_NUM + 1)));
 }
 
 TEST_F(PieceTest, cannotMoveIfSourceAndDestinationAreEqual) {
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(1, 1), Coordinates(1, 1)));
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(1, 1), Coordinates(1, 1)));
 }
 
 TEST_F(PieceTest, cannotMoveIfNotInChessboard) {
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(1, 1), Coordinates(1, 2)));
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(1, 1), Coordinates(1, 2)));
 }
 
 TEST_F(PieceTest, cannotMoveIfDestinationIsOccupiedByAlly) {
-  EXPECT_FALSE(piece.isNormalMove(Coordinates(0, 0), Coordinates(0, 1)));
+  EXPECT_FALSE(piece.isNormalMove(board, Coordinates(0, 0), Coordinates(0, 1)));
 }
\ No newline at end of file
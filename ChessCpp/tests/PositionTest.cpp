@@ -0,0 +1,213 @@
+#include "pch.h"
+#include "Board.hpp"
+#include <cstring>
+#include "Perft.hpp"
+#include "Position.hpp"
+
+using Chess::Board;
+using Chess::Colour;
+using Chess::Move;
+using Chess::MoveList;
+using Chess::PerftPosition;
+using Chess::PieceType;
+using Chess::Position;
+
+/// Defines the largest leaf count checked, to keep the tests quick.
+std::uint64_t constexpr MAX_TESTED_NODES = 200000;
+
+/// Returns the moves of the list sorted, so that lists can be compared.
+std::vector<std::uint16_t> sorted(MoveList const& moves) {
+  std::vector<std::uint16_t> result;
+  for (auto const& move : moves) {
+    auto promotion = move.promotion();
+    result.push_back(static_cast<std::uint16_t>(
+      Chess::toSquare(move.source()) | Chess::toSquare(move.destination()) << 6 |
+      (promotion ? static_cast<int>(*promotion) + 1 : 0) << 12));
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+/**
+  Plays every move down to the given depth on both the board and copies of
+  the position, checking that they agree at every node.
+*/
+void expectSameTree(Board& board, Position const& position, int depth) {
+  ASSERT_EQ(board.position(), position);
+  ASSERT_EQ(board.hash(), position.key);
+  ASSERT_EQ(position.computeKey(), position.key);
+
+  MoveList boardMoves;
+  MoveList positionMoves;
+  board.generateLegalMoves(boardMoves);
+  position.generateLegalMoves(positionMoves);
+  ASSERT_EQ(sorted(boardMoves), sorted(positionMoves));
+  if (depth == 0) {
+    return;
+  }
+
+  for (auto const& move : positionMoves) {
+    auto next = position;
+    next.play(move);
+    board.move(move);
+    expectSameTree(board, next, depth - 1);
+    board.undoLastMove();
+  }
+}
+
+class PositionTest : public ::testing::TestWithParam<PerftPosition> {};
+
+TEST_P(PositionTest, leafCountsMatchTheKnownOnes) {
+  auto const& perftPosition = GetParam();
+  auto position = perftPosition.build().position();
+  auto const& expected = perftPosition.expectedNodes;
+  for (size_t i = 0; i < expected.size() && expected[i] <= MAX_TESTED_NODES;
+                                                                       ++i) {
+    EXPECT_EQ(expected[i], Chess::perft(position, i + 1))
+      << perftPosition.name << " at depth " << i + 1;
+  }
+}
+
+TEST_P(PositionTest, agreesWithTheBoardAfterEveryMove) {
+  auto board = GetParam().build();
+  expectSameTree(board, board.position(), 2);
+}
+
+TEST_P(PositionTest, convertsBackIntoAnIdenticalBoard) {
+  auto root = GetParam().build().position();
+  MoveList moves;
+  root.generateLegalMoves(moves);
+  for (auto const& move : moves) {
+    auto position = root;
+    position.play(move);
+    Board board(position);
+    EXPECT_EQ(position, board.position());
+    EXPECT_EQ(position.key, board.hash());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(StandardPositions, PositionTest,
+  ::testing::ValuesIn(Chess::standardPerftPositions()),
+  [](auto const& info) { return std::string(info.param.name); });
+
+TEST(PositionTest, isCopiedByCopyingItsBytes) {
+  Board board;
+  board.move("E2", "E4");
+  auto position = board.position();
+  Position copy;
+  std::memcpy(&copy, &position, sizeof(Position));
+  EXPECT_EQ(position, copy);
+}
+
+TEST(PositionTest, startingPositionDescribesTheStartingBoard) {
+  Board board;
+  auto position = board.position();
+  EXPECT_EQ(Colour::White, position.sideToMove);
+  EXPECT_EQ(position.occupied(), position.unmoved);
+  EXPECT_EQ(board.hash(), position.key);
+  EXPECT_EQ(Position::NO_EN_PASSANT, position.enPassantFile);
+  EXPECT_EQ(PieceType::Queen, position.typeAt(Chess::toSquare({3, 0})));
+  EXPECT_EQ(Colour::Black, position.colourAt(Chess::toSquare({3, 7})));
+  EXPECT_EQ(std::nullopt, position.typeAt(Chess::toSquare({3, 3})));
+}
+
+TEST(PositionTest, enPassantRightSurvivesTheConversion) {
+  Board board;
+  board.move("E2", "E4");
+  board.move("A7", "A6");
+  board.move("E4", "E5");
+  board.move("D7", "D5");
+  auto position = board.position();
+  EXPECT_EQ(3, position.enPassantFile);
+
+  Board converted(position);
+  EXPECT_EQ(position, converted.position());
+  EXPECT_EQ(board.hash(), converted.hash());
+  EXPECT_NO_THROW(converted.move("E5", "D6"));
+  EXPECT_EQ(nullptr, converted.at(Board::stringToCoordinates("D5")));
+}
+
+TEST(PositionTest, enPassantIsOnlyRecordedIfAPawnCanCapture) {
+  Board board;
+  board.move("E2", "E4");
+  EXPECT_EQ(Position::NO_EN_PASSANT, board.position().enPassantFile);
+}
+
+TEST(PositionTest, playingAMoveUpdatesTheKeyAndClock) {
+  Board board;
+  auto position = board.position();
+  position.play(Move({6, 0}, {5, 2}));
+  board.move("G1", "F3");
+  EXPECT_EQ(board.position(), position);
+  EXPECT_EQ(1, position.countSincePawnMoveOrCapture);
+  EXPECT_EQ(Colour::Black, position.sideToMove);
+}
+
+TEST(PositionTest, castlingMovesTheRook) {
+  Board board(std::vector<Chess::Coordinates>{}, {{0, 0}, {7, 0}}, {}, {}, {},
+              {4, 0}, {}, {}, {}, {}, {}, {4, 7});
+  auto position = board.position();
+  position.play(Move({4, 0}, {6, 0}, Move::Kind::Castling));
+  EXPECT_EQ(PieceType::Rook, position.typeAt(Chess::toSquare({5, 0})));
+  EXPECT_EQ(std::nullopt, position.typeAt(Chess::toSquare({7, 0})));
+  EXPECT_EQ(position.computeKey(), position.key);
+}
+
+TEST(PositionTest, promotionIsPlayedInOneMove) {
+  Board board(std::vector<Chess::Coordinates>{{0, 6}}, {}, {}, {}, {}, {4, 0},
+              {}, {}, {}, {}, {}, {4, 7});
+  auto position = board.position();
+  position.play(Move({0, 6}, {0, 7}, Chess::PromotionOption::Knight));
+  EXPECT_EQ(PieceType::Knight, position.typeAt(Chess::toSquare({0, 7})));
+  EXPECT_EQ(position.computeKey(), position.key);
+
+  board.move(Move({0, 6}, {0, 7}, Chess::PromotionOption::Knight));
+  EXPECT_EQ(board.position(), position);
+}
+
+TEST(PositionTest, throwsIfAPromotionIsPending) {
+  Board board(std::vector<Chess::Coordinates>{{0, 6}}, {}, {}, {}, {}, {4, 0},
+              {}, {}, {}, {}, {}, {4, 7});
+  board.move("A7", "A8");
+  EXPECT_THROW(board.position(), std::logic_error);
+}
+
+TEST(PositionTest, boardRejectsInvalidPositions) {
+  auto position = Board().position();
+  auto noBlackKing = position;
+  noBlackKing.pieces[static_cast<size_t>(PieceType::King)] &=
+                                               Chess::squareMask({4, 0});
+  noBlackKing.colours[1] &= ~Chess::squareMask({4, 7});
+  EXPECT_THROW(Board{noBlackKing}, std::invalid_argument);
+
+  auto overlapping = position;
+  overlapping.pieces[static_cast<size_t>(PieceType::Knight)] |=
+                                               Chess::squareMask({0, 0});
+  EXPECT_THROW(Board{overlapping}, std::invalid_argument);
+}
+
+TEST(PositionTest, pawnsDoubleStepOnlyFromTheirStartingRow) {
+  // custom pawns outside the starting row count as moved for both
+  Board board(std::vector<Chess::Coordinates>{{0, 3}, {2, 1}}, {}, {}, {}, {},
+              {4, 0}, {{1, 6}, {3, 3}}, {}, {}, {}, {}, {4, 7});
+  expectSameTree(board, board.position(), 3);
+
+  auto position = board.position();
+  auto unmovedOutside = position;
+  unmovedOutside.unmoved |= Chess::squareMask({0, 3});
+  EXPECT_THROW(Board{unmovedOutside}, std::invalid_argument);
+  EXPECT_THROW(board.reset(unmovedOutside), std::invalid_argument);
+  EXPECT_EQ(position, board.position());
+
+  auto movedInside = position;
+  movedInside.unmoved &= ~Chess::squareMask({1, 6});
+  EXPECT_THROW(Board{movedInside}, std::invalid_argument);
+}
+
+TEST(PositionTest, noMovesAreGeneratedWithInsufficientMaterial) {
+  Board board(std::vector<Chess::Coordinates>{}, {}, {{1, 0}}, {}, {}, {4, 0},
+              {}, {}, {}, {}, {}, {4, 7});
+  MoveList moves;
+  board.position().generateLegalMoves(moves);
+  EXPECT_TRUE(moves.empty());
+}
@@ -1,4 +1,5 @@
 #include "pch.h"
+#include "Board.hpp"
 #include "Zobrist.hpp"
 
 using Chess::Coordinates;
@@ -107,6 +108,24 @@ TEST_F(ZobristHasherTest, hashDoesNotChangeIfAttemptToMoveEmptySquare) {
   EXPECT_EQ(originalHash, hasher.hash());
 }
 
+TEST_F(ZobristHasherTest, hashesSpanSixtyFourBits) {
+  // the odds of every hash fitting in 32 bits are negligible with 64 bit keys
+  auto upperBits = hasher.hash() >> 32;
+  hasher.pieceMoved(Coordinates(0, 1), Coordinates(0, 3));
+  upperBits |= hasher.hash() >> 32;
+  hasher.togglePlayer();
+  upperBits |= hasher.hash() >> 32;
+  EXPECT_NE(0u, upperBits);
+}
+
+TEST_F(ZobristHasherTest, hashersAgreeOnTheHashOfAPosition) {
+  auto other = ZobristHasher();
+  EXPECT_EQ(hasher.hash(), other.hash());
+  hasher.pieceMoved(Coordinates(1, 0), Coordinates(2, 2));
+  other.pieceMoved(Coordinates(1, 0), Coordinates(2, 2));
+  EXPECT_EQ(hasher.hash(), other.hash());
+}
+
 TEST_F(ZobristHasherTest, hashChangesIfPlayerChanges) {
   auto originalHash = hasher.hash();
   hasher.togglePlayer();
@@ -164,6 +183,18 @@ TEST_F(ZobristHasherTest, undoingPromotionRestoresPreviousState) {
   EXPECT_EQ(afterMoveHash, hasher.hash());
 }
 
+TEST_F(ZobristHasherTest, onlyADoubleStepGrantsTheRightToEnPassant) {
+  hasher.pieceMoved(Coordinates(0, 1), Coordinates(0, 4));
+  hasher.pieceMoved(Coordinates(1, 6), Coordinates(1, 4));
+  hasher.pieceMoved(Coordinates(6, 0), Coordinates(5, 2));
+  hasher.pieceMoved(Coordinates(5, 2), Coordinates(6, 0));
+  auto noEnPassantHash = hasher.hash();
+
+  hasher.pieceMoved(Coordinates(1, 4), Coordinates(1, 5));
+  hasher.pieceMoved(Coordinates(1, 5), Coordinates(1, 4));
+  EXPECT_EQ(noEnPassantHash, hasher.hash());
+}
+
 TEST_F(ZobristHasherTest, undoingCanRestoreEnPassantState) {
   hasher.pieceMoved(Coordinates(0, 1), Coordinates(0, 4));
   hasher.pieceMoved(Coordinates(1, 6), Coordinates(1, 4));
@@ -313,4 +344,36 @@ TEST_F(ZobristHasherTest, hashIsTheSameAfterReset) {
   hasher.reset();
   hasher.pieceMoved(Coordinates(1,2), Coordinates(2,2));
   EXPECT_EQ(hasher.hash(), originalHash);
-}
\ No newline at end of file
+}
+
+TEST_F(ZobristHasherTest, resettingToAPositionTakesItsKey) {
+  Chess::Board board;
+  board.move("G1", "F3");
+  auto position = board.position();
+  hasher.pieceMoved(Coordinates(1, 1), Coordinates(1, 3));
+  hasher.reset(position);
+  EXPECT_EQ(position.key, hasher.hash());
+  hasher.pieceMoved(Coordinates(1, 7), Coordinates(2, 5));
+  hasher.togglePlayer();
+  board.move("B8", "C6");
+  EXPECT_EQ(board.hash(), hasher.hash());
+}
+
+TEST_F(ZobristHasherTest, orderOfCustomPiecesDoesNotChangeHash) {
+  ZobristHasher movedFirst({{1, 4}, {4, 1}}, {}, {}, {}, {}, {0, 4},
+                           {}, {}, {}, {}, {}, {7, 3});
+  ZobristHasher movedLast({{4, 1}, {1, 4}}, {}, {}, {}, {}, {0, 4},
+                          {}, {}, {}, {}, {}, {7, 3});
+  EXPECT_EQ(movedFirst.hash(), movedLast.hash());
+}
+
+TEST_F(ZobristHasherTest, hashOfAPositionMatchesItsKey) {
+  Chess::Board board;
+  board.move("E2", "E4");
+  board.move("A7", "A6");
+  board.move("E4", "E5");
+  board.move("D7", "D5");
+  auto position = board.position();
+  EXPECT_EQ(position.key, ZobristHasher(position).hash());
+  EXPECT_EQ(board.hash(), ZobristHasher(position).hash());
+}